@@ -346,6 +346,23 @@ public:
         });
     }
 
+    //! Unwrap a single position to its absolute location
+    /*! \param v Coordinates to unwrap
+     *  \param image Image flags for this point
+     *  \returns The unwrapped coordinates
+     */
+    vec3<float> unwrap(const vec3<float>& v, const vec3<int>& image) const
+    {
+        vec3<float> unwrapped = v;
+        unwrapped += getLatticeVector(0) * float(image.x);
+        unwrapped += getLatticeVector(1) * float(image.y);
+        if (!m_2d)
+        {
+            unwrapped += getLatticeVector(2) * float(image.z);
+        }
+        return unwrapped;
+    }
+
     //! Unwrap given positions to their absolute location in place
     /*! \param vecs Vectors of coordinates to unwrap
      *  \param images images flags for this point
@@ -356,12 +373,7 @@ public:
         util::forLoopWrapper(0, Nvecs, [=](size_t begin, size_t end) {
             for (size_t i = begin; i < end; ++i)
             {
-                vecs[i] += getLatticeVector(0) * float(images[i].x);
-                vecs[i] += getLatticeVector(1) * float(images[i].y);
-                if (!m_2d)
-                {
-                    vecs[i] += getLatticeVector(2) * float(images[i].z);
-                }
+                vecs[i] = unwrap(vecs[i], images[i]);
             }
         });
     }
@@ -381,16 +393,33 @@ public:
 
         for (size_t i = 0; i < Nvecs; ++i)
         {
-            vec3<float> phase(constants::TWO_PI * makeFractional(vecs[i]));
-            vec3<std::complex<float>> xi(std::polar(float(1.0), phase.x), std::polar(float(1.0), phase.y),
-                                         std::polar(float(1.0), phase.z));
             float mass = (masses != nullptr) ? masses[i] : float(1.0);
             total_mass += mass;
-            xi_mean += std::complex<float>(mass, 0) * xi;
+            xi_mean += std::complex<float>(mass, 0) * periodicPhase(vecs[i]);
         }
         xi_mean /= std::complex<float>(total_mass, 0);
 
-        return wrap(makeAbsolute(vec3<float>(std::arg(xi_mean.x), std::arg(xi_mean.y), std::arg(xi_mean.z))
+        return fromPeriodicPhase(xi_mean);
+    }
+
+    //! Map a vector to a point on the unit circle along each box vector
+    /*! Averages of these points are independent of the image of each
+     *  vector, so they give periodic means such as the center of mass.
+     *  \param v Vector to map
+     */
+    vec3<std::complex<float>> periodicPhase(const vec3<float>& v) const
+    {
+        const vec3<float> phase(constants::TWO_PI * makeFractional(v));
+        return vec3<std::complex<float>>(std::polar(float(1.0), phase.x), std::polar(float(1.0), phase.y),
+                                         std::polar(float(1.0), phase.z));
+    }
+
+    //! Map a (weighted) sum of periodicPhase values back to a position in the box
+    /*! \param xi_sum Sum of phases, which need not be normalized
+     */
+    vec3<float> fromPeriodicPhase(const vec3<std::complex<float>>& xi_sum) const
+    {
+        return wrap(makeAbsolute(vec3<float>(std::arg(xi_sum.x), std::arg(xi_sum.y), std::arg(xi_sum.z))
                                  / constants::TWO_PI));
     }
 
@@ -1,13 +1,12 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
-#include <algorithm>
 #include <numeric>
+#include <tbb/parallel_sort.h>
 
 #include "Cluster.h"
 #include "NeighborBond.h"
 #include "NeighborComputeFunctional.h"
-#include "dset/dset.h"
 
 //! Finds clusters using a network of neighbors.
 namespace freud { namespace cluster {
@@ -16,7 +15,6 @@ void Cluster::compute(const freud::locality::NeighborQuery* nq, const freud::loc
                       freud::locality::QueryArgs qargs, const unsigned int* keys)
 {
     const unsigned int num_points = nq->getNPoints();
-    m_cluster_idx.prepare(num_points);
     DisjointSets dj(num_points);
 
     freud::locality::loopOverNeighbors(
@@ -29,95 +27,93 @@ void Cluster::compute(const freud::locality::NeighborQuery* nq, const freud::loc
             }
         });
 
-    // Done looping over points. All clusters are now determined.
-    // Next, we renumber clusters from zero to num_clusters-1.
-    // These new cluster indexes are then sorted by cluster size from largest
-    // to smallest, with equally-sized clusters sorted based on their minimum
-    // point index.
-    std::vector<size_t> cluster_label(num_points, num_points);
-    std::vector<size_t> cluster_label_count(num_points);
-    std::vector<size_t> cluster_min_id(num_points, num_points);
-
-    // Loop over every point.
-    m_num_clusters = 0;
-    for (size_t i = 0; i < num_points; i++)
-    {
-        size_t s = dj.find(i);
+    assignClusters(dj, keys);
+}
 
-        // Label this cluster if we haven't seen it yet.
-        if (cluster_label[s] == num_points)
+void Cluster::assignClusters(const DisjointSets& dj, const unsigned int* keys)
+{
+    const unsigned int num_points = dj.size();
+    m_cluster_idx.prepare(num_points);
+    m_cluster_keys.prepare(num_points);
+
+    // Find the root of every point and sort the points by root. The points of
+    // each cluster then form a contiguous run in increasing point order, so
+    // the first entry of each run is the smallest point index in the cluster.
+    std::vector<uint64_t> members(num_points);
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
         {
-            // Label this cluster uniquely.
-            cluster_label[s] = m_num_clusters;
-            // Track the smallest point index in this cluster.
-            cluster_min_id[cluster_label[s]] = i;
-            // Increment the count of unique clusters.
-            m_num_clusters++;
+            members[i] = (static_cast<uint64_t>(dj.find(i)) << 32) | i;
         }
-
-        // Increment the counter for this cluster label.
-        cluster_label_count[cluster_label[s]]++;
-    }
-
-    // Resize label counts and min ids to the number of unique clusters found.
-    cluster_label_count.resize(m_num_clusters);
-    cluster_label_count.shrink_to_fit();
-    cluster_min_id.resize(m_num_clusters);
-    cluster_min_id.shrink_to_fit();
-
-    // Get a permutation that reorders clusters, largest to smallest.
-    std::vector<size_t> cluster_reindex = sort_indexes_inverse(cluster_label_count, cluster_min_id);
-
-    // Clear the cluster keys
-    m_cluster_keys = std::vector<std::vector<unsigned int>>(m_num_clusters, std::vector<unsigned int>());
-
-    /* Loop over all points, set their cluster ids and add them to a list of
-     * sets. Each set contains all the keys that are part of that cluster. If
-     * no keys are provided, the keys use point ids. Get the computed list
-     * with getClusterKeys().
-     */
-    for (size_t i = 0; i < num_points; i++)
-    {
-        size_t s = dj.find(i);
-        size_t cluster_idx = cluster_reindex[cluster_label[s]];
-        m_cluster_idx[i] = cluster_idx;
-        unsigned int key = i;
-        if (keys != nullptr)
+    });
+    tbb::parallel_sort(members.begin(), members.end());
+
+    // Label the runs from zero to num_clusters-1 with a scan over the run
+    // starts, so run_labels[k] - 1 is the label of the point at position k.
+    std::vector<unsigned int> run_labels(num_points);
+    m_num_clusters = util::inclusiveScan(
+        num_points,
+        [&](size_t k) {
+            return static_cast<unsigned int>(k == 0 || (members[k] >> 32) != (members[k - 1] >> 32));
+        },
+        run_labels.data());
+
+    std::vector<unsigned int> run_starts(m_num_clusters + 1, num_points);
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k)
         {
-            key = keys[i];
+            if (k == 0 || run_labels[k] != run_labels[k - 1])
+            {
+                run_starts[run_labels[k] - 1] = k;
+            }
         }
-        m_cluster_keys[cluster_idx].push_back(key);
-    }
-}
-
-// Returns inverse permutation of cluster indexes, sorted from largest to smallest.
-// Adapted from https://stackoverflow.com/questions/1577475/c-sorting-and-keeping-track-of-indexes
-std::vector<size_t> Cluster::sort_indexes_inverse(const std::vector<size_t>& counts,
-                                                  const std::vector<size_t>& min_ids)
-{
-    // Initialize original index locations.
-    std::vector<size_t> idx(counts.size());
-    std::iota(idx.begin(), idx.end(), 0);
+    });
 
-    // Sort indexes based on comparing values in counts, min_ids.
-    std::sort(idx.begin(), idx.end(), [&counts, &min_ids](size_t i1, size_t i2) {
-        if (counts[i1] != counts[i2])
+    // Sort the clusters by size from largest to smallest, with equally-sized
+    // clusters sorted based on their minimum point index.
+    std::vector<unsigned int> cluster_order(m_num_clusters);
+    std::iota(cluster_order.begin(), cluster_order.end(), 0);
+    tbb::parallel_sort(cluster_order.begin(), cluster_order.end(), [&](unsigned int c1, unsigned int c2) {
+        const unsigned int count1 = run_starts[c1 + 1] - run_starts[c1];
+        const unsigned int count2 = run_starts[c2 + 1] - run_starts[c2];
+        if (count1 != count2)
+        {
+            return count1 > count2;
+        }
+        return static_cast<unsigned int>(members[run_starts[c1]])
+            < static_cast<unsigned int>(members[run_starts[c2]]);
+    });
+    std::vector<unsigned int> cluster_reindex(m_num_clusters);
+    util::forLoopWrapper(0, m_num_clusters, [&](size_t begin, size_t end) {
+        for (size_t n = begin; n < end; ++n)
         {
-            // If the counts are unequal, return the largest cluster first.
-            return counts[i1] > counts[i2];
+            cluster_reindex[cluster_order[n]] = n;
         }
-        // If the counts are equal, return the cluster with the smallest
-        // point id first.
-        return min_ids[i1] < min_ids[i2];
     });
 
-    // Invert the permutation.
-    std::vector<size_t> inv_idx(idx.size());
-    for (size_t i = 0; i < idx.size(); i++)
-    {
-        inv_idx[idx[i]] = i;
-    }
-    return inv_idx;
+    // The keys of cluster n are stored in
+    // m_cluster_keys[m_cluster_key_offsets[n]:m_cluster_key_offsets[n + 1]].
+    m_cluster_key_offsets.prepare(m_num_clusters + 1);
+    util::inclusiveScan(
+        m_num_clusters,
+        [&](size_t n) { return run_starts[cluster_order[n] + 1] - run_starts[cluster_order[n]]; },
+        m_cluster_key_offsets.get() + 1);
+
+    /* Loop over all points, set their cluster ids and store their keys in the
+     * range of their cluster. If no keys are provided, the keys use point
+     * ids. Get the computed keys with getClusterKeys().
+     */
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k)
+        {
+            const unsigned int label = run_labels[k] - 1;
+            const unsigned int cluster_idx = cluster_reindex[label];
+            const unsigned int i = static_cast<unsigned int>(members[k]);
+            m_cluster_idx[i] = cluster_idx;
+            m_cluster_keys[m_cluster_key_offsets[cluster_idx] + k - run_starts[label]]
+                = (keys != nullptr) ? keys[i] : i;
+        }
+    });
 }
 
 }; }; // end namespace freud::cluster
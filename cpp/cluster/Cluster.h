@@ -10,6 +10,8 @@
 #include "NeighborList.h"
 #include "NeighborQuery.h"
 #include "VectorMath.h"
+#include "dset/dset.h"
+#include "utils.h"
 
 /*! \file Cluster.h
     \brief Routines for clustering points.
@@ -32,10 +34,11 @@ namespace freud { namespace cluster {
  *  cluster. To handle this situation, an optional layer is presented on top of
  *  the cluster_idx array. Given a key value per point (e.g. the polymer id),
  *  the compute function will process clusters with the key values in mind and
- *  provide a list of keys that are present in each cluster in the attribute
- *  cluster_keys, as a list of lists. If keys are not provided, every point is
- *  assigned a key corresponding to its index, and cluster_keys contains the
- *  point ids present in each cluster.
+ *  provide the keys that are present in each cluster in the attribute
+ *  cluster_keys, stored contiguously by cluster with the start of each
+ *  cluster's keys in cluster_key_offsets. If keys are not provided, every
+ *  point is assigned a key corresponding to its index, and cluster_keys
+ *  contains the point ids present in each cluster.
  */
 class Cluster
 {
@@ -47,6 +50,38 @@ public:
     void compute(const freud::locality::NeighborQuery* nq, const freud::locality::NeighborList* nlist,
                  freud::locality::QueryArgs qargs, const unsigned int* keys = nullptr);
 
+    //! Compute the point clusters using only the NeighborList bonds accepted by a filter.
+    /*! This avoids constructing a filtered copy of the NeighborList. Bonds
+     *  are merged concurrently.
+     *
+     *  \param num_points Number of points to cluster.
+     *  \param nlist NeighborList containing candidate bonds.
+     *  \param filter Callable taking a bond index and returning whether
+     *         that bond connects its two points.
+     *  \param keys Optional key for each point.
+     */
+    template<typename BondFilter>
+    void computeFiltered(unsigned int num_points, const freud::locality::NeighborList* nlist,
+                         const BondFilter& filter, const unsigned int* keys = nullptr)
+    {
+        DisjointSets dj(num_points);
+        util::forLoopWrapper(0, nlist->getNumBonds(), [&](size_t begin, size_t end) {
+            for (size_t bond = begin; bond != end; ++bond)
+            {
+                if (filter(bond))
+                {
+                    const unsigned int i(nlist->getNeighbors()(bond, 0));
+                    const unsigned int j(nlist->getNeighbors()(bond, 1));
+                    if (!dj.same(i, j))
+                    {
+                        dj.unite(i, j);
+                    }
+                }
+            }
+        });
+        assignClusters(dj, keys);
+    }
+
     //! Get the total number of clusters.
     unsigned int getNumClusters() const
     {
@@ -59,22 +94,35 @@ public:
         return m_cluster_idx;
     }
 
-    //! Get a reference to the cluster keys.
-    const std::vector<std::vector<unsigned int>>& getClusterKeys() const
+    //! Get a reference to the keys of all clusters, stored contiguously by cluster.
+    const util::ManagedArray<unsigned int>& getClusterKeys() const
     {
         return m_cluster_keys;
     }
 
+    //! Get a reference to the offsets of each cluster's keys.
+    /*! The keys of cluster i are getClusterKeys()[offsets[i]:offsets[i + 1]],
+     *  so the array has getNumClusters() + 1 entries.
+     */
+    const util::ManagedArray<unsigned int>& getClusterKeyOffsets() const
+    {
+        return m_cluster_key_offsets;
+    }
+
+    //! Get the number of points in a cluster.
+    unsigned int getClusterSize(unsigned int cluster_idx) const
+    {
+        return m_cluster_key_offsets[cluster_idx + 1] - m_cluster_key_offsets[cluster_idx];
+    }
+
 private:
-    unsigned int m_num_clusters;                           //!< Number of clusters found
-    util::ManagedArray<unsigned int> m_cluster_idx;        //!< Cluster index for each point
-    std::vector<std::vector<unsigned int>> m_cluster_keys; //!< List of keys in each cluster
-
-    // Returns inverse permutation of cluster indices, sorted from largest to
-    // smallest. Adapted from
-    // https://stackoverflow.com/questions/1577475/c-sorting-and-keeping-track-of-indexes
-    static std::vector<size_t> sort_indexes_inverse(const std::vector<size_t>& counts,
-                                                    const std::vector<size_t>& min_ids);
+    //! Number the clusters found in a disjoint set and gather their keys.
+    void assignClusters(const DisjointSets& dj, const unsigned int* keys);
+
+    unsigned int m_num_clusters;                            //!< Number of clusters found
+    util::ManagedArray<unsigned int> m_cluster_idx;         //!< Cluster index for each point
+    util::ManagedArray<unsigned int> m_cluster_keys;        //!< Keys in each cluster, stored by cluster
+    util::ManagedArray<unsigned int> m_cluster_key_offsets; //!< Start of each cluster's keys
 };
 
 }; }; // end namespace freud::cluster
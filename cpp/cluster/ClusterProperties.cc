@@ -1,10 +1,17 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <tbb/parallel_sort.h>
 #include <vector>
 
 #include "ClusterProperties.h"
+#include "Eigen/Eigen/Dense"
 #include "NeighborComputeFunctional.h"
+#include "utils.h"
 
 /*! \file ClusterProperties.cc
     \brief Routines for computing properties of point clusters.
@@ -12,81 +19,250 @@
 
 namespace freud { namespace cluster {
 
+namespace {
+
+//! Number of sorted members reduced by each task of reduceClusters.
+constexpr size_t members_per_block = 4096;
+
+//! Reduce the points of each cluster in parallel over the sorted members.
+/*! The members are split into fixed blocks, which are reduced in parallel.
+    Clusters contained in one block are written to \a sums directly, while
+    the partial sums of clusters at the ends of each block are combined in
+    block order afterwards. The work is therefore balanced over the points,
+    even if one cluster holds most of them, and the order of summation does
+    not depend on the number of threads.
+
+    \param members Point indices in the low 32 bits, sorted by cluster.
+    \param cluster_starts Offset of each cluster in members.
+    \param sums Zeroed sums of each cluster, of length num_clusters.
+    \param add An object with operator(T& sum, unsigned int cluster, unsigned int point).
+*/
+template<typename T, typename Add>
+void reduceClusters(const std::vector<uint64_t>& members, const std::vector<size_t>& cluster_starts,
+                    std::vector<T>& sums, const Add& add)
+{
+    struct BlockEnd
+    {
+        unsigned int cluster {0};
+        T sum {};
+    };
+    const size_t num_blocks = (members.size() + members_per_block - 1) / members_per_block;
+    std::vector<BlockEnd> first_runs(num_blocks);
+    std::vector<BlockEnd> last_runs(num_blocks);
+    std::vector<char> has_first_run(num_blocks, 0);
+    std::vector<char> has_last_run(num_blocks, 0);
+
+    util::forLoopWrapper(0, num_blocks, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block)
+        {
+            const size_t block_begin = block * members_per_block;
+            const size_t block_end = std::min(block_begin + members_per_block, members.size());
+            size_t k = block_begin;
+            while (k < block_end)
+            {
+                const auto c = static_cast<unsigned int>(members[k] >> 32);
+                const size_t run_end = std::min(cluster_starts[c + 1], block_end);
+                T sum {};
+                for (; k < run_end; ++k)
+                {
+                    add(sum, c, static_cast<unsigned int>(members[k]));
+                }
+                if (cluster_starts[c] < block_begin)
+                {
+                    first_runs[block] = {c, sum};
+                    has_first_run[block] = 1;
+                }
+                else if (cluster_starts[c + 1] > block_end)
+                {
+                    last_runs[block] = {c, sum};
+                    has_last_run[block] = 1;
+                }
+                else
+                {
+                    sums[c] = sum;
+                }
+            }
+        }
+    });
+
+    // A cluster split between blocks starts with the last run of one block,
+    // continues through any blocks it fills, and ends with a first run.
+    for (size_t block = 0; block < num_blocks; ++block)
+    {
+        if (has_first_run[block] != 0)
+        {
+            sums[first_runs[block].cluster] += first_runs[block].sum;
+        }
+        if (has_last_run[block] != 0)
+        {
+            sums[last_runs[block].cluster] += last_runs[block].sum;
+        }
+    }
+}
+
+//! Total mass and sum of weighted periodic phases of a cluster.
+struct MassSum
+{
+    float mass {0};
+    vec3<std::complex<float>> xi;
+
+    MassSum& operator+=(const MassSum& other)
+    {
+        mass += other.mass;
+        xi += other.xi;
+        return *this;
+    }
+};
+
+//! Second moments and extent of the points of a cluster about its center.
+struct MomentSum
+{
+    Eigen::Matrix3d moments {Eigen::Matrix3d::Zero()};
+    vec3<float> lower {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                       std::numeric_limits<float>::max()};
+    vec3<float> upper {-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(),
+                       -std::numeric_limits<float>::max()};
+
+    void include(const vec3<float>& delta)
+    {
+        lower = vec3<float>(std::min(lower.x, delta.x), std::min(lower.y, delta.y),
+                            std::min(lower.z, delta.z));
+        upper = vec3<float>(std::max(upper.x, delta.x), std::max(upper.y, delta.y),
+                            std::max(upper.z, delta.z));
+    }
+
+    MomentSum& operator+=(const MomentSum& other)
+    {
+        moments += other.moments;
+        include(other.lower);
+        include(other.upper);
+        return *this;
+    }
+};
+
+} // namespace
+
 /*! \param nq NeighborQuery containing the points making up the clusters
     \param cluster_idx Index of which cluster each point belongs to
+    \param masses Optional mass of each point
 
-    compute loops over all points in the given array and determines the center
-    of mass of the cluster as well as the gyration tensor. These can be
-    accessed after the call to compute with getClusterCenters() and
-    getClusterGyrations().
+    compute groups the points by cluster and reduces them in parallel over
+    points, determining the center of mass of each cluster and then the
+    moments of the points about it. These can be accessed after the call to
+    compute with getClusterCenters(), getClusterGyrations(), and the other
+    getters.
 */
 
-void ClusterProperties::compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx)
+void ClusterProperties::compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx,
+                                const float* masses)
 {
+    const unsigned int num_points = nq->getNPoints();
+
     // determine the number of clusters
-    const unsigned int* max_cluster_id = std::max_element(cluster_idx, cluster_idx + nq->getNPoints());
+    const unsigned int* max_cluster_id = std::max_element(cluster_idx, cluster_idx + num_points);
     const unsigned int num_clusters = *max_cluster_id + 1;
 
     // allocate memory for the cluster properties and temporary arrays
     // initialize arrays to 0
     m_cluster_centers.prepare(num_clusters);
     m_cluster_gyrations.prepare({num_clusters, 3, 3});
+    m_cluster_inertia_tensors.prepare({num_clusters, 3, 3});
+    m_cluster_radii_of_gyration.prepare(num_clusters);
+    m_cluster_principal_moments.prepare({num_clusters, 3});
+    m_cluster_bounding_boxes.prepare({num_clusters, 2});
     m_cluster_sizes.prepare(num_clusters);
+    m_cluster_masses.prepare(num_clusters);
 
-    // Create a vector to store cluster points, used to compute center of mass
-    std::vector<std::vector<vec3<float>>> cluster_points(num_clusters, std::vector<vec3<float>>());
+    // Group the points by cluster without copying them. Sorting keeps the
+    // points of each cluster in increasing order.
+    std::vector<uint64_t> members(num_points);
+    util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            members[i] = (static_cast<uint64_t>(cluster_idx[i]) << 32) | i;
+        }
+    });
+    tbb::parallel_sort(members.begin(), members.end());
 
-    // Start by determining the center of mass of each cluster. Since we are
-    // given an array of points, the easiest way to do this is to loop over
-    // all points and add the appropriate information to m_cluster_centers as
-    // we go.
-    for (unsigned int i = 0; i < nq->getNPoints(); i++)
-    {
-        const unsigned int c = cluster_idx[i];
-        cluster_points[c].push_back((*nq)[i]);
-        m_cluster_sizes[c]++;
-    }
+    std::vector<size_t> cluster_starts(num_clusters + 1, num_points);
+    util::forLoopWrapper(0, num_clusters, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            const uint64_t first_member = static_cast<uint64_t>(c) << 32;
+            cluster_starts[c]
+                = std::lower_bound(members.begin(), members.end(), first_member) - members.begin();
+        }
+    });
 
-    // Now that we have located all of the cluster vectors, compute the centers
-    for (unsigned int c = 0; c < num_clusters; c++)
-    {
-        m_cluster_centers[c] = nq->getBox().centerOfMass(cluster_points[c].data(), m_cluster_sizes[c]);
-    }
+    const box::Box& box = nq->getBox();
 
-    // Now that we have determined the centers of mass for each cluster, tally
-    // up the gyration tensor. This has to be done in a loop over the points.
-    for (unsigned int i = 0; i < nq->getNPoints(); i++)
-    {
-        unsigned int c = cluster_idx[i];
-        vec3<float> pos = (*nq)[i];
-        vec3<float> delta = nq->getBox().wrap(pos - m_cluster_centers[c]);
-
-        // get the start pointer for our 3x3 matrix
-        m_cluster_gyrations(c, 0, 0) += delta.x * delta.x;
-        m_cluster_gyrations(c, 0, 1) += delta.x * delta.y;
-        m_cluster_gyrations(c, 0, 2) += delta.x * delta.z;
-        m_cluster_gyrations(c, 1, 0) += delta.y * delta.x;
-        m_cluster_gyrations(c, 1, 1) += delta.y * delta.y;
-        m_cluster_gyrations(c, 1, 2) += delta.y * delta.z;
-        m_cluster_gyrations(c, 2, 0) += delta.z * delta.x;
-        m_cluster_gyrations(c, 2, 1) += delta.z * delta.y;
-        m_cluster_gyrations(c, 2, 2) += delta.z * delta.z;
-    }
+    // The center of mass is found from the average of the periodic phases
+    // of the points, which properly handles periodic boundary conditions.
+    std::vector<MassSum> mass_sums(num_clusters);
+    reduceClusters(members, cluster_starts, mass_sums, [&](MassSum& sum, unsigned int, unsigned int i) {
+        const float mass = (masses != nullptr) ? masses[i] : float(1.0);
+        sum.mass += mass;
+        sum.xi += std::complex<float>(mass, 0) * box.periodicPhase((*nq)[i]);
+    });
+    util::forLoopWrapper(0, num_clusters, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            m_cluster_sizes[c] = cluster_starts[c + 1] - cluster_starts[c];
+            if (m_cluster_sizes[c] != 0)
+            {
+                m_cluster_centers[c] = box.fromPeriodicPhase(mass_sums[c].xi);
+                m_cluster_masses[c] = mass_sums[c].mass;
+            }
+        }
+    });
 
-    // Normalize by the cluster size.
-    for (unsigned int c = 0; c < num_clusters; c++)
-    {
-        auto s = static_cast<float>(m_cluster_sizes[c]);
-        m_cluster_gyrations(c, 0, 0) /= s;
-        m_cluster_gyrations(c, 0, 1) /= s;
-        m_cluster_gyrations(c, 0, 2) /= s;
-        m_cluster_gyrations(c, 1, 0) /= s;
-        m_cluster_gyrations(c, 1, 1) /= s;
-        m_cluster_gyrations(c, 1, 2) /= s;
-        m_cluster_gyrations(c, 2, 0) /= s;
-        m_cluster_gyrations(c, 2, 1) /= s;
-        m_cluster_gyrations(c, 2, 2) /= s;
-    }
+    // Tally up the second moments and the extent of the points about the
+    // center of mass.
+    std::vector<MomentSum> moment_sums(num_clusters);
+    reduceClusters(members, cluster_starts, moment_sums, [&](MomentSum& sum, unsigned int c, unsigned int i) {
+        const vec3<float> delta = box.wrap((*nq)[i] - m_cluster_centers[c]);
+        const Eigen::Vector3d d(delta.x, delta.y, delta.z);
+        const double mass = (masses != nullptr) ? masses[i] : 1.0;
+        sum.moments.noalias() += mass * d * d.transpose();
+        sum.include(delta);
+    });
+
+    util::forLoopWrapper(0, num_clusters, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            if (m_cluster_sizes[c] == 0)
+            {
+                continue;
+            }
+
+            // The gyration tensor is normalized by the total mass, while the
+            // inertia tensor is I = tr(S) * identity - S for the summed
+            // second moments S.
+            const Eigen::Matrix3d& moments = moment_sums[c].moments;
+            const Eigen::Matrix3d gyration = moments / m_cluster_masses[c];
+            const Eigen::Matrix3d inertia = moments.trace() * Eigen::Matrix3d::Identity() - moments;
+            for (unsigned int a = 0; a < 3; ++a)
+            {
+                for (unsigned int b = 0; b < 3; ++b)
+                {
+                    m_cluster_gyrations(c, a, b) = gyration(a, b);
+                    m_cluster_inertia_tensors(c, a, b) = inertia(a, b);
+                }
+            }
+            m_cluster_radii_of_gyration[c] = std::sqrt(gyration.trace());
+
+            // The principal moments are the eigenvalues of the gyration
+            // tensor, in increasing order.
+            const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> es(gyration, Eigen::EigenvaluesOnly);
+            for (unsigned int a = 0; a < 3; ++a)
+            {
+                m_cluster_principal_moments(c, a) = es.eigenvalues()[a];
+            }
+
+            m_cluster_bounding_boxes(c, 0) = m_cluster_centers[c] + moment_sums[c].lower;
+            m_cluster_bounding_boxes(c, 1) = m_cluster_centers[c] + moment_sums[c].upper;
+        }
+    });
 }
 
 }; }; // end namespace freud::cluster
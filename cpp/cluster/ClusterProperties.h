@@ -18,12 +18,16 @@ namespace freud { namespace cluster {
     source), ClusterProperties determines the following properties for each
     cluster:
      - Center of mass
-     - Gyration tensor
+     - Gyration tensor, radius of gyration, and principal moments
+     - Inertia tensor
+     - Bounding box
+     - Size and total mass
 
     m_cluster_centers stores the computed center of mass for each cluster,
     properly handling periodic boundary conditions.
     m_cluster_gyrations stores a 3x3 gyration tensor for each cluster. The
-    tensors are symmetric.
+    tensors are symmetric. If masses are provided, the moments of each point
+    are weighted by its mass.
 */
 class ClusterProperties
 {
@@ -32,7 +36,8 @@ public:
     ClusterProperties() = default;
 
     //! Compute properties of the point clusters
-    void compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx);
+    void compute(const freud::locality::NeighborQuery* nq, const unsigned int* cluster_idx,
+                 const float* masses = nullptr);
 
     //! Get a reference to the last computed cluster centers
     const util::ManagedArray<vec3<float>>& getClusterCenters() const
@@ -46,18 +51,56 @@ public:
         return m_cluster_gyrations;
     }
 
+    //! Get a reference to the last computed cluster inertia tensors
+    const util::ManagedArray<float>& getClusterInertiaTensors() const
+    {
+        return m_cluster_inertia_tensors;
+    }
+
+    //! Get a reference to the last computed cluster radii of gyration
+    const util::ManagedArray<float>& getClusterRadiiOfGyration() const
+    {
+        return m_cluster_radii_of_gyration;
+    }
+
+    //! Get a reference to the last computed principal moments of the gyration tensors
+    const util::ManagedArray<float>& getClusterPrincipalMoments() const
+    {
+        return m_cluster_principal_moments;
+    }
+
+    //! Get a reference to the last computed lower and upper corners of the cluster bounding boxes
+    const util::ManagedArray<vec3<float>>& getClusterBoundingBoxes() const
+    {
+        return m_cluster_bounding_boxes;
+    }
+
     //! Get a reference to the last computed cluster size
     const util::ManagedArray<unsigned int>& getClusterSizes() const
     {
         return m_cluster_sizes;
     }
 
+    //! Get a reference to the last computed cluster masses
+    const util::ManagedArray<float>& getClusterMasses() const
+    {
+        return m_cluster_masses;
+    }
+
 private:
     util::ManagedArray<vec3<float>>
         m_cluster_centers; //!< Center of mass computed for each cluster (length: m_num_clusters)
     util::ManagedArray<float>
         m_cluster_gyrations; //!< Gyration tensor computed for each cluster (m_num_clusters x 3 x 3 array)
+    util::ManagedArray<float>
+        m_cluster_inertia_tensors; //!< Inertia tensor about each center (m_num_clusters x 3 x 3 array)
+    util::ManagedArray<float> m_cluster_radii_of_gyration; //!< Radius of gyration per cluster
+    util::ManagedArray<float>
+        m_cluster_principal_moments; //!< Eigenvalues of each gyration tensor (m_num_clusters x 3 array)
+    util::ManagedArray<vec3<float>>
+        m_cluster_bounding_boxes; //!< Lower and upper bounding box corners (m_num_clusters x 2 array)
     util::ManagedArray<unsigned int> m_cluster_sizes; //!< Size per cluster
+    util::ManagedArray<float> m_cluster_masses;       //!< Total mass per cluster
 };
 
 }; }; // end namespace freud::cluster
@@ -0,0 +1,216 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <tbb/parallel_sort.h>
+
+#include "ClusterTracker.h"
+#include "utils.h"
+
+/*! \file ClusterTracker.cc
+    \brief Routines for tracking clusters between frames.
+*/
+
+namespace freud { namespace cluster {
+
+namespace {
+
+//! Find the start of each group of sorted entries whose upper 32 bits are the group index.
+std::vector<size_t> groupStarts(const std::vector<uint64_t>& entries, unsigned int num_groups)
+{
+    std::vector<size_t> starts(num_groups + 1, entries.size());
+    util::forLoopWrapper(0, num_groups, [&](size_t begin, size_t end) {
+        for (size_t g = begin; g < end; ++g)
+        {
+            const uint64_t first_entry = static_cast<uint64_t>(g) << 32;
+            starts[g] = std::lower_bound(entries.begin(), entries.end(), first_entry) - entries.begin();
+        }
+    });
+    return starts;
+}
+
+}; // end anonymous namespace
+
+/*! \param cluster_idx Index of which cluster each point belongs to
+    \param num_points Number of points, which must not change between frames
+
+    The overlap of clusters is found by sorting the pairs of previous and
+    current cluster indices of all points, so that the points shared by each
+    pair of clusters form a contiguous run.
+*/
+void ClusterTracker::compute(const unsigned int* cluster_idx, unsigned int num_points)
+{
+    if (m_num_frames > 0 && num_points != m_prev_cluster_idx.size())
+    {
+        throw std::invalid_argument("The number of points must be the same in every frame.");
+    }
+
+    const unsigned int num_clusters
+        = (num_points == 0) ? 0 : *std::max_element(cluster_idx, cluster_idx + num_points) + 1;
+    const auto num_prev_clusters = static_cast<unsigned int>(m_prev_cluster_ids.size());
+    m_cluster_ids.prepare(num_clusters);
+
+    if (m_num_frames == 0)
+    {
+        std::iota(m_cluster_ids.get(), m_cluster_ids.get() + num_clusters, 0);
+        m_next_id = num_clusters;
+        m_overlaps.prepare({0, 3});
+        m_splits.prepare({0, 2});
+        m_merges.prepare({0, 2});
+    }
+    else
+    {
+        // Count the points shared by each pair of previous and current clusters.
+        std::vector<uint64_t> pairs(num_points);
+        util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                pairs[i] = (static_cast<uint64_t>(m_prev_cluster_idx[i]) << 32) | cluster_idx[i];
+            }
+        });
+        tbb::parallel_sort(pairs.begin(), pairs.end());
+
+        std::vector<unsigned int> run_labels(num_points);
+        const unsigned int num_overlaps = util::inclusiveScan(
+            num_points,
+            [&](size_t k) { return static_cast<unsigned int>(k == 0 || pairs[k] != pairs[k - 1]); },
+            run_labels.data());
+        std::vector<size_t> run_starts(num_overlaps + 1, num_points);
+        util::forLoopWrapper(0, num_points, [&](size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k)
+            {
+                if (k == 0 || run_labels[k] != run_labels[k - 1])
+                {
+                    run_starts[run_labels[k] - 1] = k;
+                }
+            }
+        });
+
+        // The overlaps are sorted by previous cluster, so each previous
+        // cluster's overlaps form a row. Also sort them by current cluster,
+        // so each current cluster's overlaps form a column.
+        std::vector<uint64_t> rows(num_overlaps);
+        std::vector<uint64_t> columns(num_overlaps);
+        m_overlaps.prepare({num_overlaps, 3});
+        util::forLoopWrapper(0, num_overlaps, [&](size_t begin, size_t end) {
+            for (size_t r = begin; r < end; ++r)
+            {
+                rows[r] = pairs[run_starts[r]];
+                m_overlaps(r, 0) = static_cast<unsigned int>(rows[r] >> 32);
+                m_overlaps(r, 1) = static_cast<unsigned int>(rows[r]);
+                m_overlaps(r, 2) = run_starts[r + 1] - run_starts[r];
+                columns[r] = (static_cast<uint64_t>(m_overlaps(r, 1)) << 32) | r;
+            }
+        });
+        tbb::parallel_sort(columns.begin(), columns.end());
+        const std::vector<size_t> row_starts = groupStarts(rows, num_prev_clusters);
+        const std::vector<size_t> column_starts = groupStarts(columns, num_clusters);
+
+        // Find the largest overlap of each cluster. Rows and columns are
+        // sorted by cluster index, so ties go to the smaller index.
+        std::vector<unsigned int> successors(num_prev_clusters, num_clusters);
+        util::forLoopWrapper(0, num_prev_clusters, [&](size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p)
+            {
+                unsigned int max_overlap = 0;
+                for (size_t r = row_starts[p]; r < row_starts[p + 1]; ++r)
+                {
+                    if (m_overlaps(r, 2) > max_overlap)
+                    {
+                        max_overlap = m_overlaps(r, 2);
+                        successors[p] = m_overlaps(r, 1);
+                    }
+                }
+            }
+        });
+        std::vector<unsigned int> predecessors(num_clusters, num_prev_clusters);
+        util::forLoopWrapper(0, num_clusters, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c)
+            {
+                unsigned int max_overlap = 0;
+                for (size_t k = column_starts[c]; k < column_starts[c + 1]; ++k)
+                {
+                    const auto r = static_cast<unsigned int>(columns[k]);
+                    if (m_overlaps(r, 2) > max_overlap)
+                    {
+                        max_overlap = m_overlaps(r, 2);
+                        predecessors[c] = m_overlaps(r, 0);
+                    }
+                }
+            }
+        });
+
+        // A cluster keeps the id of its largest predecessor only if it is
+        // also that predecessor's largest successor. New ids are given in
+        // order of cluster index.
+        auto continues = [&](size_t c) {
+            return predecessors[c] != num_prev_clusters && successors[predecessors[c]] == c;
+        };
+        std::vector<unsigned int> new_ids(num_clusters);
+        const unsigned int num_new_ids = util::inclusiveScan(
+            num_clusters, [&](size_t c) { return static_cast<unsigned int>(!continues(c)); }, new_ids.data());
+        util::forLoopWrapper(0, num_clusters, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c)
+            {
+                m_cluster_ids[c]
+                    = continues(c) ? m_prev_cluster_ids[predecessors[c]] : m_next_id + new_ids[c] - 1;
+            }
+        });
+        m_next_id += num_new_ids;
+
+        // Report every overlap of a previous cluster with several current
+        // clusters as a split, and every overlap of a current cluster with
+        // several previous clusters as a merge.
+        auto row_size = [&](unsigned int p) { return row_starts[p + 1] - row_starts[p]; };
+        auto column_size = [&](unsigned int c) { return column_starts[c + 1] - column_starts[c]; };
+        std::vector<unsigned int> event_idx(num_overlaps);
+        const unsigned int num_splits = util::inclusiveScan(
+            num_overlaps, [&](size_t r) { return static_cast<unsigned int>(row_size(m_overlaps(r, 0)) > 1); },
+            event_idx.data());
+        m_splits.prepare({num_splits, 2});
+        util::forLoopWrapper(0, num_overlaps, [&](size_t begin, size_t end) {
+            for (size_t r = begin; r < end; ++r)
+            {
+                if (row_size(m_overlaps(r, 0)) > 1)
+                {
+                    m_splits(event_idx[r] - 1, 0) = m_prev_cluster_ids[m_overlaps(r, 0)];
+                    m_splits(event_idx[r] - 1, 1) = m_cluster_ids[m_overlaps(r, 1)];
+                }
+            }
+        });
+
+        const unsigned int num_merges = util::inclusiveScan(
+            num_overlaps,
+            [&](size_t k) { return static_cast<unsigned int>(column_size(columns[k] >> 32) > 1); },
+            event_idx.data());
+        m_merges.prepare({num_merges, 2});
+        util::forLoopWrapper(0, num_overlaps, [&](size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k)
+            {
+                const auto r = static_cast<unsigned int>(columns[k]);
+                if (column_size(m_overlaps(r, 1)) > 1)
+                {
+                    m_merges(event_idx[k] - 1, 0) = m_prev_cluster_ids[m_overlaps(r, 0)];
+                    m_merges(event_idx[k] - 1, 1) = m_cluster_ids[m_overlaps(r, 1)];
+                }
+            }
+        });
+    }
+
+    // Keep only what is needed to match the next frame.
+    m_prev_cluster_idx.assign(cluster_idx, cluster_idx + num_points);
+    m_prev_cluster_ids.assign(m_cluster_ids.get(), m_cluster_ids.get() + num_clusters);
+    ++m_num_frames;
+}
+
+void ClusterTracker::reset()
+{
+    m_num_frames = 0;
+    m_next_id = 0;
+    m_prev_cluster_idx.clear();
+    m_prev_cluster_ids.clear();
+}
+
+}; }; // end namespace freud::cluster
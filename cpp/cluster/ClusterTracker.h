@@ -0,0 +1,97 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef CLUSTER_TRACKER_H
+#define CLUSTER_TRACKER_H
+
+#include <vector>
+
+#include "ManagedArray.h"
+
+/*! \file ClusterTracker.h
+    \brief Routines for tracking clusters between frames.
+*/
+
+namespace freud { namespace cluster {
+
+//! Tracks the identity of clusters from frame to frame
+/*! Given the cluster index of each point in consecutive frames (from Cluster,
+    or some other source), ClusterTracker assigns each cluster a persistent
+    id. Points are assumed to keep their index between frames.
+
+    Each call to compute counts the points shared by every pair of clusters in
+    the previous and current frames, giving a sparse overlap matrix. A current
+    cluster keeps the id of a previous cluster if each is the other's largest
+    overlap, with ties broken by the smaller cluster index. All other current
+    clusters receive new ids. A previous cluster overlapping several current
+    clusters is reported as a split, and a current cluster overlapping several
+    previous clusters is reported as a merge.
+
+    Only the cluster indices and ids of the previous frame are kept between
+    calls, so the memory used does not grow with the number of frames.
+*/
+class ClusterTracker
+{
+public:
+    //! Constructor
+    ClusterTracker() = default;
+
+    //! Match the clusters of a new frame to the clusters of the previous frame
+    void compute(const unsigned int* cluster_idx, unsigned int num_points);
+
+    //! Forget the previous frame, so the next frame starts new ids from zero
+    void reset();
+
+    //! Get the number of frames computed since the last reset
+    unsigned int getNumFrames() const
+    {
+        return m_num_frames;
+    }
+
+    //! Get a reference to the persistent id of each cluster in the last frame
+    const util::ManagedArray<unsigned int>& getClusterIds() const
+    {
+        return m_cluster_ids;
+    }
+
+    //! Get a reference to the overlaps between the clusters of the last two frames
+    /*! Each row holds the previous cluster index, the current cluster index,
+     *  and the number of points they share, sorted by cluster indices.
+     */
+    const util::ManagedArray<unsigned int>& getOverlaps() const
+    {
+        return m_overlaps;
+    }
+
+    //! Get a reference to the split events of the last frame
+    /*! Each row holds the persistent id of a previous cluster that split and
+     *  the persistent id of one of the current clusters it overlaps.
+     */
+    const util::ManagedArray<unsigned int>& getSplits() const
+    {
+        return m_splits;
+    }
+
+    //! Get a reference to the merge events of the last frame
+    /*! Each row holds the persistent id of one of the previous clusters that
+     *  merged and the persistent id of the current cluster they overlap.
+     */
+    const util::ManagedArray<unsigned int>& getMerges() const
+    {
+        return m_merges;
+    }
+
+private:
+    unsigned int m_num_frames {0};                 //!< Number of frames computed since the last reset
+    unsigned int m_next_id {0};                    //!< Next unused persistent id
+    std::vector<unsigned int> m_prev_cluster_idx;  //!< Cluster index of each point in the previous frame
+    std::vector<unsigned int> m_prev_cluster_ids;  //!< Persistent id of each cluster in the previous frame
+    util::ManagedArray<unsigned int> m_cluster_ids; //!< Persistent id of each cluster in the last frame
+    util::ManagedArray<unsigned int> m_overlaps;    //!< Sparse overlap matrix (N_overlaps x 3 array)
+    util::ManagedArray<unsigned int> m_splits;      //!< Split events (N_splits x 2 array)
+    util::ManagedArray<unsigned int> m_merges;      //!< Merge events (N_merges x 2 array)
+};
+
+}; }; // end namespace freud::cluster
+
+#endif // CLUSTER_TRACKER_H
@@ -99,6 +99,20 @@ void CorrelationFunction<T>::accumulate(const freud::locality::NeighborQuery* ne
         });
 }
 
+template<typename T>
+void CorrelationFunction<T>::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                                                  const T* values, unsigned int n_frames,
+                                                  unsigned int n_points, freud::locality::QueryArgs qargs)
+{
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t frame) {
+            const T* frame_values = values + frame * n_points;
+            accumulate(neighbor_query, frame_values, neighbor_query->getPoints(), frame_values, n_points,
+                       nullptr, qargs);
+        });
+}
+
 template class CorrelationFunction<std::complex<double>>;
 template class CorrelationFunction<double>;
 
@@ -60,6 +60,12 @@ public:
                     const vec3<float>* query_points, const T* query_values, unsigned int n_query_points,
                     const freud::locality::NeighborList* nlist, freud::locality::QueryArgs qargs);
 
+    //! Accumulate all frames of a trajectory, using the points of each frame as the query points.
+    /*! \param values The values of all frames, with n_points consecutive values per frame.
+     */
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points, const T* values,
+                              unsigned int n_frames, unsigned int n_points, freud::locality::QueryArgs qargs);
+
     //! \internal
     //! helper function to reduce the thread specific arrays into one array
     void reduce() override;
@@ -89,4 +89,14 @@ void RDF::accumulate(const freud::locality::NeighborQuery* neighbor_query, const
                       });
 }
 
+void RDF::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points, unsigned int n_frames,
+                               unsigned int n_points, freud::locality::QueryArgs qargs)
+{
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t /*frame*/) {
+            accumulate(neighbor_query, neighbor_query->getPoints(), n_points, nullptr, qargs);
+        });
+}
+
 }; }; // end namespace freud::density
@@ -31,6 +31,10 @@ public:
                     unsigned int n_query_points, const freud::locality::NeighborList* nlist,
                     freud::locality::QueryArgs qargs);
 
+    //! Accumulate all frames of a trajectory, using the points of each frame as the query points.
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points, unsigned int n_frames,
+                              unsigned int n_points, freud::locality::QueryArgs qargs);
+
     //! Reduce thread-local arrays onto the primary data arrays.
     void reduce() override;
 
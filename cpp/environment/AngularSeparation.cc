@@ -1,6 +1,9 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <vector>
+
 #include "AngularSeparation.h"
 #include "NeighborComputeFunctional.h"
 #include "utils.h"
@@ -11,43 +14,99 @@
 
 namespace freud { namespace environment {
 
-float computeSeparationAngle(const quat<float>& ref_q, const quat<float>& q)
-{
-    quat<float> R = q * conj(ref_q);
-    auto theta = float(2.0 * std::acos(util::clamp(R.s, -1, 1)));
-    return theta;
-}
-
-// The set of all equivalent quaternions equiv_qs is the set that takes the particle as it
-// is defined to some global reference orientation. Thus, to be safe, we must include
-// a rotation by qconst as defined below when doing the calculation.
-// Important: equiv_qs must include both q and -q, for all included quaternions
-float computeMinSeparationAngle(const quat<float>& ref_q, const quat<float>& q, const quat<float>* equiv_qs,
-                                unsigned int n_equiv_quats)
+namespace {
+
+//! Equivalent orientations stored as a 4 x n matrix for batched dot products.
+/*! The separation angle between ref_q and q is 2 acos((q conj(ref_q)).s),
+ *  and the scalar part of q conj(ref_q) is the 4D dot product q . ref_q.
+ *  Testing q conj(e_0) e_i for each equivalent orientation e_i, as in
+ *
+ *      theta = min_i 2 acos((q conj(e_0) e_i) . ref_q),
+ *
+ *  only requires the largest dot product, since acos is decreasing. Left
+ *  multiplication by a unit quaternion preserves dot products, so
+ *
+ *      (q conj(e_0) e_i) . ref_q = e_i . (e_0 conj(q) ref_q),
+ *
+ *  and each comparison reduces to one quaternion product followed by dot
+ *  products with the columns of this matrix and a single acos.
+ *
+ *  Important: the equivalent orientations must include both q and -q, for
+ *  all included quaternions.
+ */
+class EquivalentOrientations
 {
-    quat<float> qconst = equiv_qs[0];
-    // here we undo a rotation represented by one of the equivalent orientations
-    quat<float> qtemp = q * conj(qconst);
-
-    // start with the quaternion before it has been rotated by equivalent rotations
-    float min_angle = computeSeparationAngle(ref_q, q);
+public:
+    EquivalentOrientations(const quat<float>* equiv_qs, unsigned int n_equiv_quats)
+        : m_first(equiv_qs[0]), m_s(n_equiv_quats), m_x(n_equiv_quats), m_y(n_equiv_quats),
+          m_z(n_equiv_quats)
+    {
+        for (unsigned int i = 0; i < n_equiv_quats; ++i)
+        {
+            m_s[i] = equiv_qs[i].s;
+            m_x[i] = equiv_qs[i].v.x;
+            m_y[i] = equiv_qs[i].v.y;
+            m_z[i] = equiv_qs[i].v.z;
+        }
+    }
 
-    // loop through all equivalent rotations and see if they have smaller angles with ref_q
-    for (unsigned int i = 0; i < n_equiv_quats; ++i)
+    //! Compute the minimum separation angle between ref_q and all orientations equivalent to q.
+    float minSeparationAngle(const quat<float>& ref_q, const quat<float>& q) const
     {
-        quat<float> qe = equiv_qs[i];
-        quat<float> qtest = qtemp * qe;
+        // start with the quaternion before it has been rotated by equivalent rotations
+        return separationAngle(std::max(dot(q, ref_q), maxDot(m_first * conj(q) * ref_q)));
+    }
 
-        float angle_test = computeSeparationAngle(ref_q, qtest);
+    //! Compute the largest dot product of w with any equivalent orientation.
+    float maxDot(const quat<float>& w) const
+    {
+        const float* s(m_s.data());
+        const float* x(m_x.data());
+        const float* y(m_y.data());
+        const float* z(m_z.data());
+        float max_dot(-2);
+        for (size_t i = 0; i < m_s.size(); ++i)
+        {
+            const float d(s[i] * w.s + x[i] * w.v.x + y[i] * w.v.y + z[i] * w.v.z);
+            max_dot = d > max_dot ? d : max_dot;
+        }
+        return max_dot;
+    }
 
-        if (angle_test < min_angle)
+    //! Compute the dot products of w with all equivalent orientations.
+    void dots(const quat<float>& w, float* result) const
+    {
+        const float* s(m_s.data());
+        const float* x(m_x.data());
+        const float* y(m_y.data());
+        const float* z(m_z.data());
+        for (size_t i = 0; i < m_s.size(); ++i)
         {
-            min_angle = angle_test;
+            result[i] = s[i] * w.s + x[i] * w.v.x + y[i] * w.v.y + z[i] * w.v.z;
         }
     }
 
-    return min_angle;
-}
+    //! Convert the scalar part of the relative rotation to an angle.
+    static float separationAngle(float cos_half_angle)
+    {
+        return float(2.0 * std::acos(util::clamp(cos_half_angle, -1, 1)));
+    }
+
+    //! Get the first equivalent orientation.
+    const quat<float>& first() const
+    {
+        return m_first;
+    }
+
+private:
+    quat<float> m_first;    //!< The first equivalent orientation, undone before applying the others
+    std::vector<float> m_s; //!< Scalar parts of the equivalent orientations
+    std::vector<float> m_x; //!< First vector components of the equivalent orientations
+    std::vector<float> m_y; //!< Second vector components of the equivalent orientations
+    std::vector<float> m_z; //!< Third vector components of the equivalent orientations
+};
+
+}; // end anonymous namespace
 
 void AngularSeparationNeighbor::compute(const locality::NeighborQuery* nq, const quat<float>* orientations,
                                         const vec3<float>* query_points,
@@ -62,7 +121,9 @@ void AngularSeparationNeighbor::compute(const locality::NeighborQuery* nq, const
     const size_t tot_num_neigh = m_nlist.getNumBonds();
     m_angles.prepare(tot_num_neigh);
 
-    util::forLoopWrapper(0, nq->getNPoints(), [=](size_t begin, size_t end) {
+    const EquivalentOrientations equiv(equiv_orientations, n_equiv_orientations);
+
+    util::forLoopWrapper(0, nq->getNPoints(), [&](size_t begin, size_t end) {
         size_t bond(m_nlist.find_first_index(begin));
         for (size_t i = begin; i < end; ++i)
         {
@@ -73,8 +134,7 @@ void AngularSeparationNeighbor::compute(const locality::NeighborQuery* nq, const
                 const size_t j(m_nlist.getNeighbors()(bond, 1));
                 quat<float> query_q = query_orientations[j];
 
-                float theta = computeMinSeparationAngle(q, query_q, equiv_orientations, n_equiv_orientations);
-                m_angles[bond] = theta;
+                m_angles[bond] = equiv.minSeparationAngle(q, query_q);
             }
         }
     });
@@ -87,16 +147,36 @@ void AngularSeparationGlobal::compute(const quat<float>* global_orientations, un
 {
     m_angles.prepare({n_points, n_global});
 
-    util::forLoopWrapper(0, n_points, [=](size_t begin, size_t end) {
+    // For each global orientation g, the dot products of e_0 conj(g) q with
+    // the equivalent orientations e_i are those of q with conj(e_0 conj(g)) e_i.
+    // These are computed once here, so each (particle, global) pair only
+    // needs dot products of q with a precomputed matrix, together with g
+    // itself for the unrotated comparison.
+    const EquivalentOrientations equiv(equiv_orientations, n_equiv_orientations);
+    const unsigned int n_columns = n_equiv_orientations + 1;
+    std::vector<quat<float>> columns(static_cast<size_t>(n_global) * n_columns);
+    for (unsigned int j = 0; j < n_global; ++j)
+    {
+        const quat<float> global_q = global_orientations[j];
+        const quat<float> undo = conj(equiv.first() * conj(global_q));
+        columns[j * n_columns] = global_q;
+        for (unsigned int k = 0; k < n_equiv_orientations; ++k)
+        {
+            columns[j * n_columns + k + 1] = undo * equiv_orientations[k];
+        }
+    }
+    const EquivalentOrientations rotated_columns(columns.data(), static_cast<unsigned int>(columns.size()));
+
+    util::forLoopWrapper(0, n_points, [&](size_t begin, size_t end) {
+        std::vector<float> dots(columns.size());
         for (size_t i = begin; i < end; ++i)
         {
-            quat<float> q = orientations[i];
+            rotated_columns.dots(orientations[i], dots.data());
             for (unsigned int j = 0; j < n_global; j++)
             {
-                quat<float> global_q = global_orientations[j];
-                float theta
-                    = computeMinSeparationAngle(q, global_q, equiv_orientations, n_equiv_orientations);
-                m_angles(i, j) = theta;
+                const float* global_dots(&dots[j * n_columns]);
+                m_angles(i, j) = EquivalentOrientations::separationAngle(
+                    *std::max_element(global_dots, global_dots + n_columns));
             }
         }
     });
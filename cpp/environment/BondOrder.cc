@@ -79,8 +79,8 @@ const util::ManagedArray<float>& BondOrder::getBondOrder()
     return reduceAndReturn(m_bo_array);
 }
 
-void BondOrder::accumulate(const locality::NeighborQuery* neighbor_query, quat<float>* orientations,
-                           vec3<float>* query_points, quat<float>* query_orientations,
+void BondOrder::accumulate(const locality::NeighborQuery* neighbor_query, const quat<float>* orientations,
+                           const vec3<float>* query_points, const quat<float>* query_orientations,
                            unsigned int n_query_points, const freud::locality::NeighborList* nlist,
                            freud::locality::QueryArgs qargs)
 {
@@ -128,4 +128,17 @@ void BondOrder::accumulate(const locality::NeighborQuery* neighbor_query, quat<f
                       });
 }
 
+void BondOrder::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                                     const quat<float>* orientations, unsigned int n_frames,
+                                     unsigned int n_points, freud::locality::QueryArgs qargs)
+{
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t frame) {
+            const quat<float>* frame_orientations = orientations + frame * n_points;
+            accumulate(neighbor_query, frame_orientations, neighbor_query->getPoints(), frame_orientations,
+                       n_points, nullptr, qargs);
+        });
+}
+
 }; }; // end namespace freud::environment
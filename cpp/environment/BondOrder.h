@@ -40,9 +40,18 @@ public:
     ~BondOrder() override = default;
 
     //! Accumulate the bond order
-    void accumulate(const locality::NeighborQuery* neighbor_query, quat<float>* orientations,
-                    vec3<float>* query_points, quat<float>* query_orientations, unsigned int n_query_points,
-                    const freud::locality::NeighborList* nlist, freud::locality::QueryArgs qargs);
+    void accumulate(const locality::NeighborQuery* neighbor_query, const quat<float>* orientations,
+                    const vec3<float>* query_points, const quat<float>* query_orientations,
+                    unsigned int n_query_points, const freud::locality::NeighborList* nlist,
+                    freud::locality::QueryArgs qargs);
+
+    //! Accumulate all frames of a trajectory, using the points of each frame as the query points.
+    /*! \param orientations The orientations of all frames, with n_points consecutive orientations per
+     *         frame.
+     */
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                              const quat<float>* orientations, unsigned int n_frames, unsigned int n_points,
+                              freud::locality::QueryArgs qargs);
 
     void reduce() override;
 
@@ -1,6 +1,9 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is part of the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <vector>
+
 #include "LocalBondProjection.h"
 #include "NeighborComputeFunctional.h"
 
@@ -11,41 +14,6 @@
 
 namespace freud { namespace environment {
 
-// The set of all equivalent quaternions equiv_qs is the set that takes the particle as it
-// is defined to some global reference orientation. Thus, to be safe, we must include
-// a rotation by qconst as defined below when doing the calculation.
-// IMPT: equiv_qs does NOT have to include both q and -q, for all included quaternions.
-// Rather, equiv_qs SHOULD contain the identity, and have the same length as the order of
-// the chiral symmetry group of the particle shape.
-// q and -q effect the same rotation on vectors, and here we just use equiv_quats to
-// find all symmetrically equivalent vectors to proj_vec.
-float computeMaxProjection(const vec3<float>& proj_vec, const vec3<float>& local_bond,
-                           const quat<float>* equiv_qs, unsigned int n_equiv_qs)
-{
-    quat<float> qconst = equiv_qs[0];
-
-    // start with the reference vector before it has been rotated by equivalent quaternions
-    float max_proj = dot(proj_vec, local_bond);
-
-    // loop through all equivalent rotations and see if they have a larger projection onto local_bond
-    for (unsigned int i = 0; i < n_equiv_qs; i++)
-    {
-        quat<float> qe = equiv_qs[i];
-        // here we undo a rotation represented by one of the equivalent orientations
-        quat<float> qtest = conj(qconst) * qe;
-        vec3<float> equiv_proj_vec = rotate(qtest, proj_vec);
-
-        float proj_test = dot(equiv_proj_vec, local_bond);
-
-        if (proj_test > max_proj)
-        {
-            max_proj = proj_test;
-        }
-    }
-
-    return max_proj;
-}
-
 void LocalBondProjection::compute(const locality::NeighborQuery* nq, const quat<float>* orientations,
                                   const vec3<float>* query_points, unsigned int n_query_points,
                                   const vec3<float>* proj_vecs, unsigned int n_proj,
@@ -61,8 +29,44 @@ void LocalBondProjection::compute(const locality::NeighborQuery* nq, const quat<
     m_local_bond_proj.prepare({tot_num_neigh, n_proj});
     m_local_bond_proj_norm.prepare({tot_num_neigh, n_proj});
 
+    // The set of all equivalent quaternions equiv_orientations is the set that takes the particle as it
+    // is defined to some global reference orientation. Thus, to be safe, we must include
+    // a rotation by qconst as defined below when doing the calculation.
+    // IMPT: equiv_orientations does NOT have to include both q and -q, for all included quaternions.
+    // Rather, it SHOULD contain the identity, and have the same length as the order of
+    // the chiral symmetry group of the particle shape.
+    // q and -q effect the same rotation on vectors, and here we just use the equivalent
+    // orientations to find all symmetrically equivalent vectors to each projection vector.
+    //
+    // These vectors are precomputed as the rows of an (n_proj * n_equiv) x 3 matrix
+    // stored by component. Each row group starts with the unrotated vector, and the
+    // projection of a bond is the maximum over its row group.
+    const unsigned int n_equiv_proj = n_equiv_orientations + 1;
+    const size_t n_rows = static_cast<size_t>(n_proj) * n_equiv_proj;
+    std::vector<float> proj_x(n_rows);
+    std::vector<float> proj_y(n_rows);
+    std::vector<float> proj_z(n_rows);
+    const quat<float> qconst = equiv_orientations[0];
+    for (unsigned int k = 0; k < n_proj; k++)
+    {
+        for (unsigned int e = 0; e < n_equiv_proj; e++)
+        {
+            // here we undo a rotation represented by one of the equivalent orientations
+            const vec3<float> equiv_proj_vec
+                = e == 0 ? proj_vecs[k] : rotate(conj(qconst) * equiv_orientations[e - 1], proj_vecs[k]);
+            const size_t row = static_cast<size_t>(k) * n_equiv_proj + e;
+            proj_x[row] = equiv_proj_vec.x;
+            proj_y[row] = equiv_proj_vec.y;
+            proj_z[row] = equiv_proj_vec.z;
+        }
+    }
+
     // compute the order parameter
-    util::forLoopWrapper(0, n_query_points, [=](size_t begin, size_t end) {
+    util::forLoopWrapper(0, n_query_points, [&](size_t begin, size_t end) {
+        const float* px(proj_x.data());
+        const float* py(proj_y.data());
+        const float* pz(proj_z.data());
+        std::vector<float> projections(n_rows);
         size_t bond(m_nlist.find_first_index(begin));
         for (size_t i = begin; i < end; ++i)
         {
@@ -77,11 +81,18 @@ void LocalBondProjection::compute(const locality::NeighborQuery* nq, const quat<
                 // store the length of this local bond
                 float local_bond_len = std::sqrt(dot(local_bond, local_bond));
 
+                // project the bond onto every equivalent projection vector
+                // with a single matrix-vector product
+                for (size_t row = 0; row < n_rows; row++)
+                {
+                    projections[row]
+                        = px[row] * local_bond.x + py[row] * local_bond.y + pz[row] * local_bond.z;
+                }
+
                 for (unsigned int k = 0; k < n_proj; k++)
                 {
-                    vec3<float> proj_vec = proj_vecs[k];
-                    float max_proj = computeMaxProjection(proj_vec, local_bond, equiv_orientations,
-                                                          n_equiv_orientations);
+                    const float* equiv_projections(&projections[static_cast<size_t>(k) * n_equiv_proj]);
+                    float max_proj = *std::max_element(equiv_projections, equiv_projections + n_equiv_proj);
                     m_local_bond_proj(bond, k) = max_proj;
                     m_local_bond_proj_norm(bond, k) = max_proj / local_bond_len;
                 }
@@ -1,6 +1,7 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
 #include <vector>
 
 #include "LocalDescriptors.h"
@@ -14,8 +15,8 @@
 namespace freud { namespace environment {
 
 LocalDescriptors::LocalDescriptors(unsigned int l_max, bool negative_m,
-                                   LocalDescriptorOrientation orientation)
-    : m_l_max(l_max), m_negative_m(negative_m), m_nSphs(0), m_orientation(orientation)
+                                   LocalDescriptorOrientation orientation, LocalDescriptorOutput output)
+    : m_l_max(l_max), m_negative_m(negative_m), m_nSphs(0), m_orientation(orientation), m_output(output)
 {}
 
 void LocalDescriptors::compute(const locality::NeighborQuery* nq, const vec3<float>* query_points,
@@ -30,10 +31,18 @@ void LocalDescriptors::compute(const locality::NeighborQuery* nq, const vec3<flo
     {
         max_num_neighbors = std::numeric_limits<unsigned int>::max();
     }
-    m_sphArray.prepare({m_nlist.getNumBonds(), getSphWidth()});
+    // Only the requested descriptors are stored. The power spectrum is
+    // accumulated per point, so no per-bond storage is needed for it.
+    const bool power_spectrum(m_output == PowerSpectrum);
+    m_sphArray.prepare({power_spectrum ? 0 : m_nlist.getNumBonds(), getSphWidth()});
+    m_power_spectrum.prepare({power_spectrum ? n_query_points : 0, m_l_max + 1});
 
     util::forLoopWrapper(0, nq->getNPoints(), [=](size_t begin, size_t end) {
-        fsph::PointSPHEvaluator<float> sph_eval(m_l_max);
+        util::SphericalHarmonics sph(m_l_max);
+        constexpr unsigned int batch_size(util::SphericalHarmonics::batch_size);
+        vec3<float> bonds_ij[batch_size];
+        float ones[batch_size];
+        std::fill(ones, ones + batch_size, float(1));
 
         for (size_t i = begin; i < end; ++i)
         {
@@ -100,36 +109,66 @@ void LocalDescriptors::compute(const locality::NeighborQuery* nq, const vec3<flo
             }
 
             neighbor_count = 0;
-            for (; bond < m_nlist.getNumBonds() && m_nlist.getNeighbors()(bond, 0) == i
-                 && neighbor_count < max_num_neighbors;
-                 ++bond, ++neighbor_count)
+            while (bond < m_nlist.getNumBonds() && m_nlist.getNeighbors()(bond, 0) == i
+                   && neighbor_count < max_num_neighbors)
             {
-                const unsigned int sphCount(bond * getSphWidth());
-                const size_t j(m_nlist.getNeighbors()(bond, 1));
-                const vec3<float> r_ij(bondVector(locality::NeighborBond(i, j), nq, query_points));
-                const float r_sq(dot(r_ij, r_ij));
-                const vec3<float> bond_ij(dot(rotation_0, r_ij), dot(rotation_1, r_ij),
-                                          dot(rotation_2, r_ij));
-
-                const float magR(std::sqrt(r_sq));
-
-                // Wrap theta into [0, 2*pi]
-                float theta(std::atan2(bond_ij.y, bond_ij.x));
-                theta = util::modulusPositive(theta, constants::TWO_PI);
+                // Rotate a batch of bonds into the local frame
+                const size_t first_bond(bond);
+                unsigned int num_batch(0);
+                for (; num_batch < batch_size && bond < m_nlist.getNumBonds()
+                     && m_nlist.getNeighbors()(bond, 0) == i && neighbor_count < max_num_neighbors;
+                     ++num_batch, ++bond, ++neighbor_count)
+                {
+                    const size_t j(m_nlist.getNeighbors()(bond, 1));
+                    const vec3<float> r_ij(bondVector(locality::NeighborBond(i, j), nq, query_points));
+                    bonds_ij[num_batch] = vec3<float>(dot(rotation_0, r_ij), dot(rotation_1, r_ij),
+                                                      dot(rotation_2, r_ij));
+                }
 
-                // Phi in [0, pi]
-                float phi(std::acos(bond_ij.z / magR));
+                sph.compute(bonds_ij, num_batch);
 
-                // catch cases where bond_ij.z/magR falls outside [-1, 1]
-                // due to numerical issues
-                if (std::isnan(phi))
+                if (power_spectrum)
                 {
-                    phi = bond_ij.z > 0 ? 0 : M_PI;
+                    sph.accumulate(ones, num_batch);
+                    continue;
                 }
 
-                sph_eval.compute(phi, theta);
+                // Store all m >= 0 for each l, followed by m < 0 if requested
+                for (unsigned int k = 0; k < num_batch; ++k)
+                {
+                    std::complex<float>* sph_out(&m_sphArray[(first_bond + k) * getSphWidth()]);
+                    for (unsigned int l = 0; l <= m_l_max; ++l)
+                    {
+                        for (unsigned int m = 0; m <= l; ++m)
+                        {
+                            *sph_out++ = sph.get(k, l, m);
+                        }
+                        if (m_negative_m)
+                        {
+                            for (unsigned int m = 1; m <= l; ++m)
+                            {
+                                *sph_out++ = std::conj(sph.get(k, l, m));
+                            }
+                        }
+                    }
+                }
+            }
 
-                std::copy(sph_eval.begin(m_negative_m), sph_eval.end(), &m_sphArray[sphCount]);
+            if (power_spectrum)
+            {
+                // Since Y_l^{-m} = conj(Y_l^m) for these harmonics, which omit
+                // the Condon-Shortley phase, the sums over bonds for -m and m
+                // have equal magnitudes.
+                const std::vector<std::complex<float>>& sums(sph.reduce());
+                for (unsigned int l = 0; l <= m_l_max && i < n_query_points; ++l)
+                {
+                    float power(std::norm(sums[util::SphericalHarmonics::index(l, 0)]));
+                    for (unsigned int m = 1; m <= l; ++m)
+                    {
+                        power += 2 * std::norm(sums[util::SphericalHarmonics::index(l, m)]);
+                    }
+                    m_power_spectrum(i, l) = power;
+                }
             }
         }
     });
@@ -10,8 +10,8 @@
 #include "ManagedArray.h"
 #include "NeighborList.h"
 #include "NeighborQuery.h"
+#include "SphericalHarmonics.h"
 #include "VectorMath.h"
-#include "fsph/src/spherical_harmonics.hpp"
 
 /*! \file LocalDescriptors.h
   \brief Computes local descriptors.
@@ -26,6 +26,12 @@ enum LocalDescriptorOrientation
     ParticleLocal
 };
 
+enum LocalDescriptorOutput
+{
+    BondHarmonics,
+    PowerSpectrum
+};
+
 /*! Compute a set of descriptors (a numerical "fingerprint") of a
  *  particle's local environment.
  */
@@ -36,7 +42,10 @@ public:
     //!
     //! \param l_max Maximum spherical harmonic l to consider
     //! \param negative_m whether to calculate Ylm for negative m
-    LocalDescriptors(unsigned int l_max, bool negative_m, LocalDescriptorOrientation orientation);
+    //! \param orientation The orientation mode to compute with
+    //! \param output Whether to store the harmonics of each bond or only the power spectrum of each point
+    LocalDescriptors(unsigned int l_max, bool negative_m, LocalDescriptorOrientation orientation,
+                     LocalDescriptorOutput output = BondHarmonics);
 
     //! Get the last number of spherical harmonics computed
     unsigned int getNSphs() const
@@ -63,10 +72,21 @@ public:
         return m_sphArray;
     }
 
+    //! Get a reference to the last computed power spectrum array
+    /*! For each query point, the power spectrum of l is
+     *  \f$ \sum_{m=-l}^{l} \left| \sum_{bonds} Y_l^m \right|^2 \f$, which
+     *  is invariant to rotations of the environment.
+     */
+    const util::ManagedArray<float>& getPowerSpectrum() const
+    {
+        return m_power_spectrum;
+    }
+
     //! Return the number of spherical harmonics that will be computed for each bond.
     unsigned int getSphWidth() const
     {
-        return fsph::sphCount(m_l_max) + (m_l_max > 0 && m_negative_m ? fsph::sphCount(m_l_max - 1) : 0);
+        return util::SphericalHarmonics::count(m_l_max)
+            + (m_l_max > 0 && m_negative_m ? util::SphericalHarmonics::count(m_l_max - 1) : 0);
     }
 
     //! Return a pointer to the NeighborList used in the last call to compute.
@@ -85,15 +105,23 @@ public:
         return m_orientation;
     }
 
+    LocalDescriptorOutput getOutput() const
+    {
+        return m_output;
+    }
+
 private:
     unsigned int m_l_max;                     //!< Maximum spherical harmonic l to calculate
     bool m_negative_m;                        //!< true if we should compute Ylm for negative m
     unsigned int m_nSphs;                     //!< Last number of bond spherical harmonics computed
     locality::NeighborList m_nlist;           //!< The NeighborList used in the last call to compute.
     LocalDescriptorOrientation m_orientation; //!< The orientation mode to compute with.
+    LocalDescriptorOutput m_output;           //!< The descriptors to compute.
 
     //! Spherical harmonics for each neighbor
     util::ManagedArray<std::complex<float>> m_sphArray;
+    //! Power spectrum of the summed spherical harmonics of each query point
+    util::ManagedArray<float> m_power_spectrum;
 };
 
 }; }; // end namespace freud::environment
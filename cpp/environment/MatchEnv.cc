@@ -1,13 +1,19 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
 
 #include "MatchEnv.h"
 
 #include "NeighborBond.h"
 #include "NeighborComputeFunctional.h"
+#include "utils.h"
 
 namespace freud { namespace environment {
 
@@ -18,255 +24,255 @@ EnvDisjointSet::EnvDisjointSet(unsigned int Np) : rank(std::vector<unsigned int>
 {}
 
 void EnvDisjointSet::merge(const unsigned int a, const unsigned int b,
-                           BiMap<unsigned int, unsigned int> vec_map, rotmat3<float>& rotation)
+                           const BiMap<unsigned int, unsigned int>& vec_map, const rotmat3<float>& rotation)
 {
-    // if tree heights are equal, merge b to a
-    if (rank[s[a].env_ind] == rank[s[b].env_ind])
+    const unsigned int head_a = find(a);
+    const unsigned int head_b = find(b);
+    if (head_a == head_b)
     {
-        // Get the ENTIRE set that corresponds to head_b.
-        unsigned int head_b = find(b);
-        std::vector<unsigned int> m_set = findSet(head_b);
-        for (unsigned int node : m_set)
-        {
-            // Go through the entire tree/set.
-            // Make a copy of the old set of vector indices for this
-            // particular node.
-            std::vector<unsigned int> old_node_vec_ind = s[node].vec_ind;
-
-            // Set the vector indices properly.
-            // Take the LEFT MAP view of the proper_a<->proper_b bimap.
-            // Iterate over the values of proper_a_ind IN ORDER, find the
-            // value of proper_b_ind that corresponds to each proper_a_ind,
-            // and set it properly.
-            for (unsigned int proper_a_ind = 0; proper_a_ind < vec_map.size(); proper_a_ind++)
-            {
-                unsigned int proper_b_ind = vec_map.left[proper_a_ind];
+        return;
+    }
 
-                // old_node_vec_ind[proper_b_ind] is "relative_b_ind"
-                s[node].vec_ind[proper_a_ind] = old_node_vec_ind[proper_b_ind];
-            }
+    // After find, a and b are either heads, with the identity transformation,
+    // or direct children of their heads. Their transformations therefore
+    // express their PROPERLY ORDERED and PROPERLY ROTATED vectors, and the
+    // match between the vectors as built can be expressed in those terms.
+    const Environment& env_a = s[a];
+    const Environment& env_b = s[b];
 
-            // set the environment index properly
-            s[node].env_ind = s[a].env_ind;
+    std::vector<unsigned int> proper_b_ind(env_b.vec_ind.size());
+    for (unsigned int proper_ind = 0; proper_ind < env_b.vec_ind.size(); proper_ind++)
+    {
+        proper_b_ind[env_b.vec_ind[proper_ind]] = proper_ind;
+    }
 
-            // set the proper orientation. ORDER MATTERS since rotations
-            // don't commute in 3D.
-            s[node].proper_rot = rotation * s[node].proper_rot;
+    // proper_map[proper_a_ind] is the matching proper_b_ind
+    std::vector<unsigned int> proper_map(env_a.vec_ind.size());
+    for (unsigned int proper_a_ind = 0; proper_a_ind < env_a.vec_ind.size(); proper_a_ind++)
+    {
+        proper_map[proper_a_ind] = proper_b_ind[vec_map.left.at(env_a.vec_ind[proper_a_ind])];
+    }
+
+    // the rotation taking the PROPERLY ROTATED vectors b to those of a. ORDER
+    // MATTERS since rotations don't commute in 3D.
+    const rotmat3<float> proper_rotation = env_a.proper_rot * rotation * transpose(env_b.proper_rot);
 
-            // we've added another leaf to the tree or whatever the lingo is.
-            rank[s[a].env_ind]++;
+    // Attach the shorter tree to the taller one. Only the head of the
+    // attached tree is updated; its members are resolved lazily by find.
+    if (rank[head_a] < rank[head_b])
+    {
+        // we are rotating the vectors of a to match those of b, so we need
+        // the INVERSE (transpose) of the rotation and of the mapping.
+        Environment& head = s[head_a];
+        for (unsigned int proper_a_ind = 0; proper_a_ind < proper_map.size(); proper_a_ind++)
+        {
+            head.vec_ind[proper_map[proper_a_ind]] = proper_a_ind;
         }
+        head.proper_rot = transpose(proper_rotation);
+        head.env_ind = head_b;
     }
     else
     {
-        // merge the shorter tree to the taller one
-        if (rank[s[a].env_ind] > rank[s[b].env_ind])
+        Environment& head = s[head_b];
+        head.vec_ind = proper_map;
+        head.proper_rot = proper_rotation;
+        head.env_ind = head_a;
+        if (rank[head_a] == rank[head_b])
         {
-            // Get the ENTIRE set that corresponds to head_b.
-            unsigned int head_b = find(b);
-            std::vector<unsigned int> m_set = findSet(head_b);
-            for (unsigned int node : m_set)
-            {
-                // Go through the entire tree/set.
-                // Make a copy of the old set of vector indices for this
-                // particular node. This is complicated and weird.
-                std::vector<unsigned int> old_node_vec_ind = s[node].vec_ind;
-
-                // Set the vector indices properly.
-                // Take the LEFT MAP view of the proper_a<->proper_b bimap.
-                // Iterate over the values of proper_a_ind IN ORDER, find the
-                // value of proper_b_ind that corresponds to each proper_a_ind,
-                // and set it properly.
-                for (unsigned int proper_a_ind = 0; proper_a_ind < vec_map.size(); proper_a_ind++)
-                {
-                    unsigned int proper_b_ind = vec_map.left[proper_a_ind];
-
-                    // old_node_vec_ind[proper_b_ind] is "relative_b_ind"
-                    s[node].vec_ind[proper_a_ind] = old_node_vec_ind[proper_b_ind];
-                }
-                // set the environment index properly
-                s[node].env_ind = s[a].env_ind;
-
-                // set the proper orientation. ORDER MATTERS since rotations
-                // don't commute in 3D.
-                s[node].proper_rot = rotation * s[node].proper_rot;
-
-                // we've added another leaf to the tree or whatever the lingo is.
-                rank[s[a].env_ind]++;
-            }
-        }
-        else
-        {
-            rotmat3<float> rotationT = transpose(rotation);
-            // Get the ENTIRE set that corresponds to head_a.
-            unsigned int head_a = find(a);
-            std::vector<unsigned int> m_set = findSet(head_a);
-            for (unsigned int node : m_set)
-            {
-                // Go through the entire tree/set.
-                // Make a copy of the old set of vector indices for this
-                // particular node. This is complicated and weird.
-                std::vector<unsigned int> old_node_vec_ind = s[node].vec_ind;
-
-                // Set the vector indices properly.
-                // Take the RIGHT MAP view of the proper_a<->proper_b bimap.
-                // Iterate over the values of proper_b_ind IN ORDER, find the
-                // value of proper_a_ind that corresponds to each proper_b_ind,
-                // and set it properly.
-                for (unsigned int proper_b_ind = 0; proper_b_ind < vec_map.size(); proper_b_ind++)
-                {
-                    unsigned int proper_a_ind = vec_map.right[proper_b_ind];
-
-                    // old_node_vec_ind[proper_a_ind] is "relative_a_ind"
-                    s[node].vec_ind[proper_b_ind] = old_node_vec_ind[proper_a_ind];
-                }
-
-                // set the environment index properly
-                s[node].env_ind = s[b].env_ind;
-
-                // set the proper orientation. ORDER MATTERS since rotations
-                // don't commute in 3D.
-                // note that here we are rotating vector set proper_a such
-                // that it matches vector set proper_b, so we need to multiply
-                // by the INVERSE (transpose) of the matrix rotation.
-                s[node].proper_rot = rotationT * s[node].proper_rot;
-
-                // we've added another leaf to the tree or whatever the lingo is.
-                rank[s[b].env_ind]++;
-            }
+            rank[head_a]++;
         }
     }
 }
 
 unsigned int EnvDisjointSet::find(const unsigned int c)
 {
-    unsigned int r = c;
-
     // follow up to the head of the tree
+    std::vector<unsigned int> path;
+    unsigned int r = c;
     while (s[r].env_ind != r)
     {
+        path.push_back(r);
         r = s[r].env_ind;
     }
 
-    // path compression
-    unsigned int i = c;
-    while (i != r)
+    // path compression, starting from the node closest to the head. Each
+    // node's parent has already been attached directly to the head, so
+    // composing the two transformations expresses the node relative to the
+    // head. ORDER MATTERS since rotations don't commute in 3D.
+    for (auto node = path.rbegin(); node != path.rend(); ++node)
     {
-        unsigned int j = s[i].env_ind;
-        s[i].env_ind = r;
-        i = j;
+        Environment& env = s[*node];
+        const Environment& parent = s[env.env_ind];
+        if (env.env_ind == r)
+        {
+            continue;
+        }
+        std::vector<unsigned int> vec_ind(env.vec_ind.size());
+        for (unsigned int proper_ind = 0; proper_ind < vec_ind.size(); proper_ind++)
+        {
+            vec_ind[proper_ind] = env.vec_ind[parent.vec_ind[proper_ind]];
+        }
+        env.vec_ind = std::move(vec_ind);
+        env.proper_rot = parent.proper_rot * env.proper_rot;
+        env.env_ind = r;
     }
     return r;
 }
 
-std::vector<unsigned int> EnvDisjointSet::findSet(const unsigned int m)
+std::vector<vec3<float>> EnvDisjointSet::getIndividualEnv(const unsigned int m)
 {
-    bool invalid_ind = true;
+    if (m >= s.size())
+    {
+        std::ostringstream msg;
+        msg << "Index " << m << " must be less than the size of the environment set!" << std::endl;
+        throw std::invalid_argument(msg.str());
+    }
 
-    std::vector<unsigned int> m_set;
+    // resolve the transformation of m relative to its head
+    find(m);
 
-    // this is wildly inefficient
-    for (unsigned int i = 0; i < s.size(); i++)
+    std::vector<vec3<float>> env(m_max_num_neigh, vec3<float>(0.0, 0.0, 0.0));
+
+    // loop through the vectors, getting them properly indexed
+    for (unsigned int proper_ind = 0; proper_ind < s[m].vecs.size(); proper_ind++)
     {
-        // get the head environment index
-        unsigned int head_env = find(s[i].env_ind);
-        // if we are part of the environment m, add the vectors to m_set
-        if (head_env == m)
-        {
-            m_set.push_back(i);
-            invalid_ind = false;
-        }
+        unsigned int relative_ind = s[m].vec_ind[proper_ind];
+        env[proper_ind] = s[m].proper_rot * s[m].vecs[relative_ind];
     }
 
-    if (invalid_ind)
+    return env;
+}
+
+/*************************
+ * Convenience functions *
+ *************************/
+std::vector<float> makeFingerprint(const Environment& e)
+{
+    std::vector<float> fingerprint(e.vecs.size());
+    for (unsigned int m = 0; m < e.vecs.size(); m++)
     {
-        std::ostringstream msg;
-        msg << "Index " << m << " must be a head index in the environment set!" << std::endl;
-        throw std::invalid_argument(msg.str());
+        fingerprint[m] = std::sqrt(dot(e.vecs[m], e.vecs[m]));
     }
+    std::sort(fingerprint.begin(), fingerprint.end());
+    return fingerprint;
+}
 
-    return m_set;
+bool fingerprintsMatch(const std::vector<float>& f1, const std::vector<float>& f2, float tolerance)
+{
+    if (f1.size() != f2.size())
+    {
+        return false;
+    }
+    for (unsigned int m = 0; m < f1.size(); m++)
+    {
+        if (std::abs(f1[m] - f2[m]) > tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-std::vector<vec3<float>> EnvDisjointSet::getAvgEnv(const unsigned int m)
+namespace {
+
+//! Tolerance for comparing fingerprints given the matching threshold.
+/*! The lengths of rotated vectors are only preserved up to floating point
+ *  error, so a small margin keeps the fingerprint test conservative.
+ */
+float fingerprintTolerance(float threshold)
 {
-    bool invalid_ind = true;
+    return threshold * 1.001f + 1e-5f;
+}
 
-    std::vector<vec3<float>> env(m_max_num_neigh, vec3<float>(0.0, 0.0, 0.0));
-    unsigned int N = 0;
+//! Spatial hash of environment fingerprints for finding candidate matches.
+/*! Environments are binned by their number of vectors and by their shortest,
+ *  median, and longest vector lengths, with bins as wide as the tolerance.
+ *  Any environment whose fingerprint matches another's lies in the same or
+ *  an adjacent bin in each of these lengths.
+ */
+class FingerprintIndex
+{
+public:
+    FingerprintIndex(const std::vector<std::vector<float>>& fingerprints, float tolerance)
+        : m_fingerprints(fingerprints), m_tolerance(tolerance)
+    {
+        for (unsigned int i = 0; i < m_fingerprints.size(); i++)
+        {
+            m_bins[binOf(m_fingerprints[i])].push_back(i);
+        }
+    }
 
-    // loop over all the environments in the set
-    for (auto& i : s)
+    //! Get the sorted indices j > i of all environments whose fingerprints match that of i.
+    std::vector<unsigned int> candidates(unsigned int i) const
     {
-        // if this environment is NOT a ghost (i.e. non-physical):
-        if (!i.ghost)
+        const BinKey key = binOf(m_fingerprints[i]);
+        std::vector<unsigned int> result;
+        for (int d0 = -1; d0 <= 1; d0++)
         {
-            // get the head environment index
-            unsigned int head_env = find(i.env_ind);
-            // if we are part of the environment m, add the vectors to env
-            if (head_env == m)
+            for (int d1 = -1; d1 <= 1; d1++)
             {
-                // loop through the vectors, getting them properly indexed
-                // add them to env
-                for (unsigned int proper_ind = 0; proper_ind < i.vecs.size(); proper_ind++)
+                for (int d2 = -1; d2 <= 1; d2++)
                 {
-                    unsigned int relative_ind = i.vec_ind[proper_ind];
-                    env[proper_ind] += i.proper_rot * i.vecs[relative_ind];
+                    const BinKey neighbor_key {std::get<0>(key), std::get<1>(key) + d0,
+                                               std::get<2>(key) + d1, std::get<3>(key) + d2};
+                    const auto bin = m_bins.find(neighbor_key);
+                    if (bin == m_bins.end())
+                    {
+                        continue;
+                    }
+                    for (const unsigned int j : bin->second)
+                    {
+                        if (j > i && fingerprintsMatch(m_fingerprints[i], m_fingerprints[j], m_tolerance))
+                        {
+                            result.push_back(j);
+                        }
+                    }
                 }
-                ++N;
-                invalid_ind = false;
             }
         }
+        std::sort(result.begin(), result.end());
+        return result;
     }
 
-    if (invalid_ind)
-    {
-        std::ostringstream msg;
-        msg << "Index " << m << " must be a head index in the environment set!" << std::endl;
-        throw std::invalid_argument(msg.str());
-    }
+private:
+    using BinKey = std::tuple<size_t, long, long, long>;
 
-    // loop through the vectors in env now, dividing by the total number
-    // of contributing particle environments to make an average
-    for (unsigned int n = 0; n < m_max_num_neigh; n++)
+    BinKey binOf(const std::vector<float>& fingerprint) const
     {
-        vec3<float> normed = env[n] / static_cast<float>(N);
-        env[n] = normed;
+        if (fingerprint.empty())
+        {
+            return BinKey {0, 0, 0, 0};
+        }
+        const auto bin = [this](float length) { return static_cast<long>(std::floor(length / m_tolerance)); };
+        return BinKey {fingerprint.size(), bin(fingerprint.front()), bin(fingerprint[fingerprint.size() / 2]),
+                       bin(fingerprint.back())};
     }
-    return env;
-}
 
-std::vector<vec3<float>> EnvDisjointSet::getIndividualEnv(const unsigned int m)
-{
-    if (m >= s.size())
-    {
-        std::ostringstream msg;
-        msg << "Index " << m << " must be less than the size of the environment set!" << std::endl;
-        throw std::invalid_argument(msg.str());
-    }
+    const std::vector<std::vector<float>>& m_fingerprints; //!< Fingerprint of each environment
+    const float m_tolerance;                               //!< Bin width and matching tolerance
+    std::map<BinKey, std::vector<unsigned int>> m_bins;    //!< Environment indices in each bin
+};
 
-    std::vector<vec3<float>> env;
-    for (unsigned int n = 0; n < m_max_num_neigh; n++)
-    {
-        env.emplace_back(0.0, 0.0, 0.0);
-    }
+//! The rotation and vector mapping found by comparing two environments.
+using EnvMatch = std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>>;
 
-    // loop through the vectors, getting them properly indexed
-    // add them to env
-    for (unsigned int proper_ind = 0; proper_ind < s[m].vecs.size(); proper_ind++)
+//! Express the vectors of an unmerged environment in the frame of a motif it matches.
+void applyMatch(Environment& env, EnvMatch& match)
+{
+    if (!match.second.empty())
     {
-        unsigned int relative_ind = s[m].vec_ind[proper_ind];
-        env[proper_ind] += s[m].proper_rot * s[m].vecs[relative_ind];
+        for (unsigned int proper_ind = 0; proper_ind < env.vec_ind.size(); proper_ind++)
+        {
+            env.vec_ind[proper_ind] = match.second.left[proper_ind];
+        }
+        env.proper_rot = match.first;
     }
-
-    return env;
 }
 
-/*************************
- * Convenience functions *
- *************************/
-std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> isSimilar(Environment& e1, Environment& e2,
-                                                                       float threshold_sq, bool registration)
+}; // end anonymous namespace
+
+std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>>
+isSimilar(const Environment& e1, const Environment& e2, float threshold_sq, bool registration)
 {
     BiMap<unsigned int, unsigned int> vec_map;
     rotmat3<float> rotation = rotmat3<float>(); // this initializes to the identity matrix
@@ -399,8 +405,8 @@ std::pair<Environment, Environment> makeEnvironments(const box::Box& box, const
     return std::pair<Environment, Environment>(e0, e1);
 }
 
-std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> minimizeRMSD(Environment& e1, Environment& e2,
-                                                                          float& min_rmsd, bool registration)
+std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>>
+minimizeRMSD(const Environment& e1, const Environment& e2, float& min_rmsd, bool registration)
 {
     BiMap<unsigned int, unsigned int> vec_map;
     rotmat3<float> rotation = rotmat3<float>(); // this initializes to the identity matrix
@@ -481,6 +487,16 @@ MatchEnv::MatchEnv() = default;
 
 MatchEnv::~MatchEnv() = default;
 
+void MatchEnv::storeEnv(const Environment& env, unsigned int i)
+{
+    const unsigned int num_vecs = std::min(static_cast<unsigned int>(env.vecs.size()),
+                                           static_cast<unsigned int>(m_point_environments.shape()[1]));
+    for (unsigned int proper_ind = 0; proper_ind < num_vecs; proper_ind++)
+    {
+        m_point_environments(i, proper_ind) = env.proper_rot * env.vecs[env.vec_ind[proper_ind]];
+    }
+}
+
 /**********************
  * EnvironmentCluster *
  **********************/
@@ -548,56 +564,115 @@ void EnvironmentCluster::compute(const freud::locality::NeighborQuery* nq,
     // reallocate the m_point_environments array
     m_point_environments.prepare({Np, dj.m_max_num_neigh});
 
-    size_t bond(0);
-    // loop through points
+    // Fingerprints are used to skip pairs of environments that cannot match.
+    // Since they never reject a matching pair, the result is unchanged.
+    std::vector<std::vector<float>> fingerprints(Np);
     for (unsigned int i = 0; i < Np; i++)
     {
-        if (!global)
-        {
-            // loop over the neighbors
-            for (; bond < nlist.getNumBonds() && nlist.getNeighbors()(bond, 0) == i; ++bond)
+        fingerprints[i] = makeFingerprint(dj.s[i]);
+    }
+    const float tolerance = fingerprintTolerance(threshold);
+    std::unique_ptr<FingerprintIndex> index;
+    if (global)
+    {
+        index = std::make_unique<FingerprintIndex>(fingerprints, tolerance);
+    }
+
+    // Similarity is evaluated in parallel on the environments as built, and
+    // the matches are merged serially afterwards in the same order as a
+    // serial loop over the points would merge them.
+    const std::vector<Environment> envs(dj.s);
+    if (!global)
+    {
+        // Compare every pair of neighbors, then merge the matching pairs in
+        // neighbor list order.
+        const size_t num_bonds(nlist.getNumBonds());
+        std::vector<EnvMatch> matches(num_bonds);
+        util::forLoopWrapper(0, num_bonds, [&](size_t begin, size_t end) {
+            for (size_t bond = begin; bond < end; ++bond)
             {
+                const size_t i(nlist.getNeighbors()(bond, 0));
                 const size_t j(nlist.getNeighbors()(bond, 1));
-                std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> mapping
-                    = isSimilar(dj.s[i], dj.s[j], m_threshold_sq, registration);
-                rotmat3<float> rotation = mapping.first;
-                BiMap<unsigned int, unsigned int> vec_map = mapping.second;
-                // if the mapping between the vectors of the environments
-                // is NOT empty, then the environments are similar, so
-                // merge them.
-                if (!vec_map.empty())
+                if (fingerprintsMatch(fingerprints[i], fingerprints[j], tolerance))
                 {
-                    // merge the two sets using the disjoint set
-                    unsigned int a = dj.find(i);
-                    unsigned int b = dj.find(j);
-                    if (a != b)
-                    {
-                        dj.merge(i, j, vec_map, rotation);
-                    }
+                    matches[bond] = isSimilar(envs[i], envs[j], m_threshold_sq, registration);
                 }
             }
+        });
+
+        for (size_t bond = 0; bond < num_bonds; ++bond)
+        {
+            const unsigned int i(nlist.getNeighbors()(bond, 0));
+            const unsigned int j(nlist.getNeighbors()(bond, 1));
+            // if the mapping between the vectors of the environments is NOT
+            // empty, then the environments are similar, so merge them.
+            if (!matches[bond].second.empty() && dj.find(i) != dj.find(j))
+            {
+                dj.merge(i, j, matches[bond].second, matches[bond].first);
+            }
         }
-        else
+    }
+    else
+    {
+        for (unsigned int i = 0; i < Np; i++)
         {
-            // loop over all other particles
-            for (unsigned int j = i + 1; j < Np; j++)
+            // Only the members of each other set up to its first match with
+            // i are ever compared, since the rest of the set is merged with i
+            // by that match. Group the candidates by set and compare them one
+            // member of every unresolved set at a time.
+            const unsigned int head_i = dj.find(i);
+            std::map<unsigned int, std::vector<unsigned int>> candidate_sets;
+            for (const unsigned int j : index->candidates(i))
             {
-                std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> mapping
-                    = isSimilar(dj.s[i], dj.s[j], m_threshold_sq, registration);
-                rotmat3<float> rotation = mapping.first;
-                BiMap<unsigned int, unsigned int> vec_map = mapping.second;
-                // if the mapping between the vectors of the environments
-                // is NOT empty, then the environments are similar, so
-                // merge them.
-                if (!vec_map.empty())
+                const unsigned int head_j = dj.find(j);
+                if (head_j != head_i)
                 {
-                    // merge the two sets using the disjoint set
-                    unsigned int a = dj.find(i);
-                    unsigned int b = dj.find(j);
-                    if (a != b)
+                    candidate_sets[head_j].push_back(j);
+                }
+            }
+            std::vector<std::vector<unsigned int>> sets;
+            for (auto& candidate_set : candidate_sets)
+            {
+                sets.push_back(std::move(candidate_set.second));
+            }
+
+            std::vector<EnvMatch> matches(sets.size());
+            std::vector<unsigned int> matched(sets.size(), Np);
+            std::vector<unsigned int> unresolved(sets.size());
+            std::iota(unresolved.begin(), unresolved.end(), 0);
+            for (unsigned int member = 0; !unresolved.empty(); member++)
+            {
+                util::forLoopWrapper(0, unresolved.size(), [&](size_t begin, size_t end) {
+                    for (size_t k = begin; k < end; ++k)
                     {
-                        dj.merge(i, j, vec_map, rotation);
+                        const unsigned int set = unresolved[k];
+                        const unsigned int j = sets[set][member];
+                        EnvMatch match = isSimilar(envs[i], envs[j], m_threshold_sq, registration);
+                        if (!match.second.empty())
+                        {
+                            matches[set] = match;
+                            matched[set] = j;
+                        }
                     }
+                });
+                unresolved.erase(std::remove_if(unresolved.begin(), unresolved.end(),
+                                                [&](unsigned int set) {
+                                                    return matched[set] != Np
+                                                        || member + 1 >= sets[set].size();
+                                                }),
+                                 unresolved.end());
+            }
+
+            // merge in the order that the matching points were found
+            std::vector<unsigned int> order(sets.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(),
+                      [&](unsigned int a, unsigned int b) { return matched[a] < matched[b]; });
+            for (const unsigned int set : order)
+            {
+                if (matched[set] != Np && dj.find(i) != dj.find(matched[set]))
+                {
+                    dj.merge(i, matched[set], matches[set].second, matches[set].first);
                 }
             }
         }
@@ -608,14 +683,14 @@ void EnvironmentCluster::compute(const freud::locality::NeighborQuery* nq,
     m_num_clusters = populateEnv(dj);
 }
 
-unsigned int EnvironmentCluster::populateEnv(EnvDisjointSet dj)
+unsigned int EnvironmentCluster::populateEnv(EnvDisjointSet& dj)
 {
     std::map<unsigned int, unsigned int> label_map;
-    std::map<unsigned int, std::vector<vec3<float>>> cluster_env;
+    std::vector<std::vector<vec3<float>>> cluster_env;
+    std::vector<unsigned int> cluster_size;
 
     // loop over all environments
     unsigned int label_ind;
-    unsigned int cur_set = 0;
     unsigned int particle_ind = 0;
     for (unsigned int i = 0; i < dj.s.size(); i++)
     {
@@ -627,39 +702,44 @@ unsigned int EnvironmentCluster::populateEnv(EnvDisjointSet dj)
 
             unsigned int c = dj.find(i);
             // insert the set into the mapping if we haven't seen it before.
-            // also grab the vectors that define the set and insert them into cluster_env
             if (label_map.count(c) == 0)
             {
-                label_map[c] = cur_set;
-                std::vector<vec3<float>> vecs = dj.getAvgEnv(c);
-                label_ind = label_map[c];
-                cluster_env[label_ind] = vecs;
-                cur_set++;
+                label_ind = static_cast<unsigned int>(cluster_env.size());
+                label_map[c] = label_ind;
+                cluster_env.emplace_back(dj.m_max_num_neigh, vec3<float>(0.0, 0.0, 0.0));
+                cluster_size.push_back(0);
             }
             else
             {
                 label_ind = label_map[c];
             }
 
-            // label this particle in m_env_index
+            // label this particle in m_env_index, and add its vectors to
+            // those of its cluster
             m_env_index[particle_ind] = label_ind;
             for (unsigned int m = 0; m < part_vecs.size(); m++)
             {
                 m_point_environments(particle_ind, m) = part_vecs[m];
+                cluster_env[label_ind][m] += part_vecs[m];
             }
+            ++cluster_size[label_ind];
             particle_ind++;
         }
     }
 
-    // Now update the vector of environments from the map.
-    m_cluster_environments.resize(cluster_env.size());
-    for (const auto& it : cluster_env)
+    // divide by the total number of contributing particle environments to
+    // make an average
+    for (unsigned int cluster = 0; cluster < cluster_env.size(); cluster++)
     {
-        m_cluster_environments[it.first] = it.second;
+        for (auto& vec : cluster_env[cluster])
+        {
+            vec /= static_cast<float>(cluster_size[cluster]);
+        }
     }
+    m_cluster_environments = std::move(cluster_env);
 
     // specify the number of cluster environments
-    return cur_set;
+    return static_cast<unsigned int>(m_cluster_environments.size());
 }
 
 /*************************
@@ -678,12 +758,6 @@ void EnvironmentMotifMatch::compute(const freud::locality::NeighborQuery* nq,
 
     nlist.validate(Np, Np);
 
-    // create a disjoint set where all particles belong in their own cluster.
-    // this has to have ONE MORE environment than there are actual particles,
-    // because we're inserting the motif into it.
-    EnvDisjointSet dj(Np + 1);
-    dj.m_max_num_neigh = motif_size;
-
     // reallocate the m_point_environments array
     m_point_environments.prepare({Np, motif_size});
 
@@ -702,44 +776,29 @@ void EnvironmentMotifMatch::compute(const freud::locality::NeighborQuery* nq,
         e0.addVec(p);
     }
 
-    // add this environment to the set
-    dj.s.push_back(e0);
-
-    size_t bond(0);
     const size_t num_bonds(nlist.getNumBonds());
 
     m_matches.prepare(Np);
 
-    // loop through the particles and add their environments to the set
-    // take care, here: set things up s.t. the env_ind of every environment
-    // matches its location in the disjoint set.
-    // if you don't do this, things will get screwy.
-    for (unsigned int i = 0; i < Np; i++)
-    {
-        unsigned int dummy = i + 1;
-        Environment ei = buildEnv(nq, &nlist, num_bonds, bond, i, dummy);
-        dj.s.push_back(ei);
-
-        // if the environment matches e0, merge it into the e0 environment set
-        std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> mapping
-            = isSimilar(dj.s[0], dj.s[dummy], m_threshold_sq, registration);
-        rotmat3<float> rotation = mapping.first;
-        BiMap<unsigned int, unsigned int> vec_map = mapping.second;
-        // if the mapping between the vectors of the environments is NOT empty,
-        // then the environments are similar.
-        if (!vec_map.empty())
+    // Every particle is compared to the motif independently, so the
+    // particles are processed in parallel.
+    util::forLoopWrapper(0, Np, [&](size_t begin, size_t end) {
+        size_t bond(nlist.find_first_index(begin));
+        for (size_t i = begin; i < end; ++i)
         {
-            dj.merge(0, dummy, vec_map, rotation);
-            m_matches[i] = true;
-        }
-        // grab the set of vectors that define this individual environment
-        std::vector<vec3<float>> part_vecs = dj.getIndividualEnv(dummy);
+            Environment ei = buildEnv(nq, &nlist, num_bonds, bond, i, i + 1);
 
-        for (unsigned int m = 0; m < part_vecs.size(); m++)
-        {
-            m_point_environments(i, m) = part_vecs[m];
+            // if the mapping between the vectors of the environments is NOT
+            // empty, then the environments are similar.
+            EnvMatch mapping = isSimilar(e0, ei, m_threshold_sq, registration);
+            if (!mapping.second.empty())
+            {
+                applyMatch(ei, mapping);
+                m_matches[i] = true;
+            }
+            storeEnv(ei, i);
         }
-    }
+    });
 }
 
 /****************************
@@ -755,12 +814,6 @@ void EnvironmentRMSDMinimizer::compute(const freud::locality::NeighborQuery* nq,
 
     unsigned int Np = nq->getNPoints();
 
-    // create a disjoint set where all particles belong in their own cluster.
-    // this has to have ONE MORE environment than there are actual particles,
-    // because we're inserting the motif into it.
-    EnvDisjointSet dj(Np + 1);
-    dj.m_max_num_neigh = motif_size;
-
     // reallocate the m_point_environments array
     m_point_environments.prepare({Np, motif_size});
 
@@ -779,50 +832,29 @@ void EnvironmentRMSDMinimizer::compute(const freud::locality::NeighborQuery* nq,
         e0.addVec(p);
     }
 
-    // add this environment to the set
-    dj.s.push_back(e0);
-
-    size_t bond(0);
     const size_t num_bonds(nlist.getNumBonds());
 
     m_rmsds.prepare(Np);
 
-    // loop through the particles and add their environments to the set
-    // take care, here: set things up s.t. the env_ind of every environment
-    // matches its location in the disjoint set.
-    // if you don't do this, things will get screwy.
-    for (unsigned int i = 0; i < Np; i++)
-    {
-        unsigned int dummy = i + 1;
-        Environment ei = buildEnv(nq, &nlist, num_bonds, bond, i, dummy);
-        dj.s.push_back(ei);
-
-        // if the environment matches e0, merge it into the e0 environment set
-        float min_rmsd = -1.0;
-        std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> mapping
-            = minimizeRMSD(dj.s[0], dj.s[dummy], min_rmsd, registration);
-        rotmat3<float> rotation = mapping.first;
-        BiMap<unsigned int, unsigned int> vec_map = mapping.second;
-        // populate the min_rmsd vector
-        m_rmsds[i] = min_rmsd;
-
-        // if the mapping between the vectors of the environments is NOT
-        // empty, then the environments are similar.
-        // minimizeRMSD should always return a non-empty vec_map, except if
-        // e0 and e1 have different numbers of vectors.
-        if (!vec_map.empty())
+    // Every particle is compared to the motif independently, so the
+    // particles are processed in parallel.
+    util::forLoopWrapper(0, Np, [&](size_t begin, size_t end) {
+        size_t bond(nlist.find_first_index(begin));
+        for (size_t i = begin; i < end; ++i)
         {
-            dj.merge(0, dummy, vec_map, rotation);
-        }
+            Environment ei = buildEnv(nq, &nlist, num_bonds, bond, i, i + 1);
 
-        // grab the set of vectors that define this individual environment
-        std::vector<vec3<float>> part_vecs = dj.getIndividualEnv(dummy);
+            float min_rmsd = -1.0;
+            EnvMatch mapping = minimizeRMSD(e0, ei, min_rmsd, registration);
+            // populate the min_rmsd vector
+            m_rmsds[i] = min_rmsd;
 
-        for (unsigned int m = 0; m < part_vecs.size(); m++)
-        {
-            m_point_environments(i, m) = part_vecs[m];
+            // minimizeRMSD should always return a non-empty vec_map, except if
+            // e0 and e1 have different numbers of vectors.
+            applyMatch(ei, mapping);
+            storeEnv(ei, i);
         }
-    }
+    });
 }
 
 }; }; // end namespace freud::environment
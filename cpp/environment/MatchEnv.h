@@ -49,41 +49,56 @@ struct Environment
     rotmat3<float> proper_rot {};
 };
 
+//! Compute a rotation and permutation invariant fingerprint of an environment.
+/*! The fingerprint is the sorted list of the lengths of the environment's
+ *  vectors. If two environments are matched by isSimilar, every vector of
+ *  one is within the threshold of a distinct (possibly rotated) vector of the
+ *  other, so by the triangle inequality their sorted lengths differ pairwise
+ *  by less than the threshold as well. Comparing fingerprints therefore
+ *  rejects pairs of environments that cannot match without ever rejecting a
+ *  pair that can.
+ */
+std::vector<float> makeFingerprint(const Environment& e);
+
+//! Check whether two environments with the given fingerprints may be similar.
+/*! \param f1 Fingerprint of the first environment.
+ *  \param f2 Fingerprint of the second environment.
+ *  \param tolerance Maximum difference between corresponding lengths.
+ *  \return False if the environments cannot match within the tolerance.
+ */
+bool fingerprintsMatch(const std::vector<float>& f1, const std::vector<float>& f2, float tolerance);
+
 //! General disjoint set class, taken mostly from Cluster.h
+/*! The env_ind of each environment in the set is the index of its parent in
+ * the tree, and its vec_ind and proper_rot give the order and orientation of
+ * its vectors relative to its parent. Heads have the identity
+ * transformation. Merging only attaches one head to the other, and find
+ * composes the transformations along the path to the head as it compresses
+ * it, so the proper order and rotation of an environment relative to its
+ * head are only resolved when they are needed.
+ */
 struct EnvDisjointSet
 {
     //! Constructor (taken partially from Cluster.cc).
     explicit EnvDisjointSet(unsigned int Np);
     //! Merge two sets
     /*! Merge the two sets that elements a and b belong to. Taken partially
-     * from Cluster.cc. The vec_map must be a bimap of PROPERLY ORDERED vector
-     * indices where those of set a are on the left and those of set b are on
-     * the right. The rotation must take the set of PROPERLY ROTATED vectors b
-     * and rotate them to match the set of PROPERLY ROTATED vectors a
+     * from Cluster.cc. The vec_map must be a bimap of the indices of the
+     * vectors of a and b as they were built, where those of a are on the
+     * left and those of b are on the right. The rotation must take the
+     * vectors of b as they were built and rotate them to match those of a.
      */
-    void merge(const unsigned int a, const unsigned int b, BiMap<unsigned int, unsigned int> vec_map,
-               rotmat3<float>& rotation);
+    void merge(const unsigned int a, const unsigned int b, const BiMap<unsigned int, unsigned int>& vec_map,
+               const rotmat3<float>& rotation);
 
     //! Find the set with a given element (taken mostly from Cluster.cc).
-    unsigned int find(const unsigned int c);
-
-    //! Return ALL nodes in the tree that correspond to the head index m
-    /*! Return ALL nodes in the tree that correspond to the head index m.
-     * Values returned: the actual locations of the nodes in s. (i.e. if i is
-     * returned, the node is accessed by s[i]). If environment m doesn't exist
-     * as a HEAD in the set, throw an error.
-     */
-    std::vector<unsigned int> findSet(const unsigned int m);
-
-    //! Get the vectors corresponding to environment head index m.
-    /*! Vectors are averaged over all members of the environment cluster. Get
-     * the vectors corresponding to environment head index m. Vectors are
-     * averaged over all members of the environment cluster. If environment m
-     * doesn't exist as a HEAD in the set, throw an error.
+    /*! After this call, c is either the head or a direct child of the head,
+     * so its vec_ind and proper_rot are relative to the head.
      */
-    std::vector<vec3<float>> getAvgEnv(const unsigned int m);
+    unsigned int find(const unsigned int c);
 
-    //! Get the vectors corresponding to index m in the dj set (throw an error if it doesn't exist).
+    //! Get the properly ordered and rotated vectors of index m in the dj set (throw an error if it doesn't
+    //! exist).
     std::vector<vec3<float>> getIndividualEnv(const unsigned int m);
 
     std::vector<Environment> s;     //!< The disjoint set data
@@ -106,13 +121,12 @@ std::pair<Environment, Environment> makeEnvironments(const box::Box& box, const
 // REGISTERED) environment e2.
 /*! This function returns an std::pair of the rotation matrix that takes
  * the vectors of e2 to the vectors of e1 AND the mapping between the
- * properly indexed vectors of the environments that gives this RMSD.  NOTE
- * that this does not guarantee an absolutely minimal RMSD. It doesn't
- * figure out the optimal permutation of BOTH sets of vectors to minimize
- * the RMSD. Rather, it just figures out the optimal permutation of the
- * second set, the vector set used in the argument below. To fully solve
- * this, we need to use the Hungarian algorithm or some other way of
- * solving the so-called assignment problem.
+ * properly indexed vectors of the environments that gives this RMSD.  For
+ * environments of at most max_fixed_points vectors, the mapping is the
+ * optimal solution of the assignment problem. NOTE that for larger
+ * environments this does not guarantee an absolutely minimal RMSD, since
+ * each vector of the second set is greedily paired with the nearest unused
+ * vector of the first.
  *
  * \param e1 First environment.
  * \param e2 First environment.
@@ -121,8 +135,8 @@ std::pair<Environment, Environment> makeEnvironments(const box::Box& box, const
  *                     orient the second set of vectors such that it
  *                     minimizes the RMSD between the two sets
  */
-std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> minimizeRMSD(Environment& e1, Environment& e2,
-                                                                          float& min_rmsd, bool registration);
+std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>>
+minimizeRMSD(const Environment& e1, const Environment& e2, float& min_rmsd, bool registration);
 
 //! Overload of the above minimizeRMSD function that provides an easier interface to Python.
 /*! Construct the environments accordingly, and utilize minimizeRMSD() as
@@ -163,8 +177,8 @@ std::map<unsigned int, unsigned int> minimizeRMSD(const box::Box& box, const vec
  *                     orient the second set of vectors such that it
  *                     minimizes the RMSD between the two sets
  */
-std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>> isSimilar(Environment& e1, Environment& e2,
-                                                                       float threshold_sq, bool registration);
+std::pair<rotmat3<float>, BiMap<unsigned int, unsigned int>>
+isSimilar(const Environment& e1, const Environment& e2, float threshold_sq, bool registration);
 
 //! Overload of the above isSimilar function that provides an easier interface to Python.
 /*! If the two environments correspond, returns a std::pair of the rotation matrix that takes the
@@ -216,6 +230,9 @@ public:
     }
 
 protected:
+    //! Store the properly ordered and rotated vectors of an environment as those of particle i.
+    void storeEnv(const Environment& env, unsigned int i);
+
     util::ManagedArray<vec3<float>> m_point_environments; //!< m_NP by m_max_num_neighbors by 3 matrix of all
                                                           //!< environments for all particles
 };
@@ -307,7 +324,7 @@ private:
      *                with that environment (which defines the cluster).
      * \return The number of clusters found.
      */
-    unsigned int populateEnv(EnvDisjointSet dj);
+    unsigned int populateEnv(EnvDisjointSet& dj);
 
     unsigned int m_num_clusters {0};              //!< Last number of local environments computed
     util::ManagedArray<unsigned int> m_env_index; //!< Cluster index determined for each particle
@@ -4,8 +4,11 @@
 #ifndef REGISTRATION_H
 #define REGISTRATION_H
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <sstream>
 #include <vector>
@@ -156,6 +159,132 @@ inline void AlignVectorSets(matrix& P, matrix& Q, matrix* pRotation = nullptr)
     }
 }
 
+//! Largest number of points registered with fixed capacity matrices.
+constexpr int max_fixed_points = 32;
+
+//! N x 3 matrix of at most max_fixed_points rows, stored without heap allocation.
+using FixedPoints = Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::RowMajor, max_fixed_points, 3>;
+
+//! Find the proper rotation R minimizing the MSD between the rows of R * P^T and Q^T.
+/*! Uses Horn's closed form solution (DOI: 10.1364/JOSAA.4.000629): the
+ *  optimal rotation is the unit quaternion given by the eigenvector with the
+ *  largest eigenvalue of a symmetric 4x4 matrix built from the 3x3 cross
+ *  covariance of the point sets. Unlike KabschAlgorithm, the result is always
+ *  a proper rotation and no SVD is needed.
+ *
+ *  Preconditions: P and Q have the same number of rows and have been
+ *  translated to have the same center of mass.
+ */
+inline Eigen::Matrix3d HornRotation(const FixedPoints& P, const FixedPoints& Q)
+{
+    const Eigen::Matrix3d S = P.transpose() * Q;
+    Eigen::Matrix4d N;
+    N << S(0, 0) + S(1, 1) + S(2, 2), S(1, 2) - S(2, 1), S(2, 0) - S(0, 2), S(0, 1) - S(1, 0),
+        S(1, 2) - S(2, 1), S(0, 0) - S(1, 1) - S(2, 2), S(0, 1) + S(1, 0), S(2, 0) + S(0, 2),
+        S(2, 0) - S(0, 2), S(0, 1) + S(1, 0), -S(0, 0) + S(1, 1) - S(2, 2), S(1, 2) + S(2, 1),
+        S(0, 1) - S(1, 0), S(2, 0) + S(0, 2), S(1, 2) + S(2, 1), -S(0, 0) - S(1, 1) + S(2, 2);
+
+    // eigenvalues are sorted in increasing order
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix4d> solver(N);
+    const Eigen::Vector4d q = solver.eigenvectors().col(3);
+    return Eigen::Quaterniond(q[0], q[1], q[2], q[3]).normalized().toRotationMatrix();
+}
+
+//! Find the one-to-one assignment of the rows of points to those of ref_points with minimal total squared
+//! distance.
+/*! Solves the assignment problem exactly with the O(N^3) Hungarian algorithm
+ *  (in the form given by Jonker and Volgenant), using only fixed capacity
+ *  storage.
+ *
+ *  \param ref_points Reference points.
+ *  \param points Points to assign, with the same number of rows as ref_points.
+ *  \param assignment Updated by reference so that row r of points is assigned
+ *                    to row assignment[r] of ref_points.
+ *  \return The total squared distance of the assignment.
+ */
+inline double HungarianAssignment(const FixedPoints& ref_points, const FixedPoints& points,
+                                  std::array<unsigned int, max_fixed_points>& assignment)
+{
+    constexpr int size = max_fixed_points + 1;
+    const int n = static_cast<int>(points.rows());
+
+    // cost(r, c) is the squared distance between points r and ref_points c
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, max_fixed_points, max_fixed_points> cost(n, n);
+    for (int r = 0; r < n; r++)
+    {
+        cost.row(r) = (ref_points.rowwise() - points.row(r)).rowwise().squaredNorm().transpose();
+    }
+
+    // Potentials of rows and columns, and the row matched to each column.
+    // Index 0 is a sentinel column, so rows and columns are indexed from 1.
+    std::array<double, size> u {};
+    std::array<double, size> v {};
+    std::array<int, size> row_of {};
+    std::array<int, size> way {};
+    for (int r = 1; r <= n; r++)
+    {
+        row_of[0] = r;
+        int col = 0;
+        std::array<double, size> min_slack;
+        std::array<bool, size> used;
+        min_slack.fill(std::numeric_limits<double>::infinity());
+        used.fill(false);
+        do
+        {
+            used[col] = true;
+            const int row = row_of[col];
+            double delta = std::numeric_limits<double>::infinity();
+            int next_col = 0;
+            for (int c = 1; c <= n; c++)
+            {
+                if (!used[c])
+                {
+                    const double slack = cost(row - 1, c - 1) - u[row] - v[c];
+                    if (slack < min_slack[c])
+                    {
+                        min_slack[c] = slack;
+                        way[c] = col;
+                    }
+                    if (min_slack[c] < delta)
+                    {
+                        delta = min_slack[c];
+                        next_col = c;
+                    }
+                }
+            }
+            for (int c = 0; c <= n; c++)
+            {
+                if (used[c])
+                {
+                    u[row_of[c]] += delta;
+                    v[c] -= delta;
+                }
+                else
+                {
+                    min_slack[c] -= delta;
+                }
+            }
+            col = next_col;
+        } while (row_of[col] != 0);
+
+        // augment along the alternating path
+        do
+        {
+            const int prev_col = way[col];
+            row_of[col] = row_of[prev_col];
+            col = prev_col;
+        } while (col != 0);
+    }
+
+    double total = 0;
+    for (int c = 1; c <= n; c++)
+    {
+        assignment[row_of[c] - 1] = c - 1;
+        total += cost(row_of[c] - 1, c - 1);
+    }
+    return total;
+}
+
 class RegisterBruteForce
 {
 public:
@@ -183,6 +312,12 @@ public:
             throw std::invalid_argument(msg.str());
         }
 
+        if (N <= max_fixed_points)
+        {
+            FitFixed(pts);
+            return;
+        }
+
         RandomNumber<std::mt19937_64> rng;
         double rmsd_min = -1.0;
         for (size_t shuffles = 0; shuffles < m_shuffles; shuffles++)
@@ -341,8 +476,21 @@ public:
     // set, the vector set used in the argument below.
     // To fully solve this, we need to use the Hungarian algorithm or some
     // other way of solving the so-called assignment problem.
+    //
+    // Sets of at most max_fixed_points points are instead assigned optimally
+    // by HungarianAssignment.
     float AlignedRMSDTree(const matrix& points, BiMap<unsigned int, unsigned int>& m)
     {
+        if (points.rows() <= max_fixed_points && points.rows() == m_ref_points.rows() && points.cols() == 3)
+        {
+            const FixedPoints ref_points = m_ref_points;
+            const FixedPoints fixed_points = points;
+            std::array<unsigned int, max_fixed_points> assignment;
+            const double msd = HungarianAssignment(ref_points, fixed_points, assignment);
+            m = makeVecMap(assignment, points.rows());
+            return std::sqrt(msd / static_cast<double>(points.rows()));
+        }
+
         // Also brute force.
         float rmsd = 0.0;
 
@@ -386,6 +534,98 @@ public:
     }
 
 private:
+    //! Fit with fixed capacity matrices, avoiding all heap allocations in the search.
+    /*! Follows the same search over triplets as Fit, but finds each rotation
+     *  with HornRotation and each assignment with HungarianAssignment.
+     */
+    void FitFixed(std::vector<vec3<float>>& pts)
+    {
+        const int N = static_cast<int>(pts.size());
+        const FixedPoints ref_points = m_ref_points;
+        FixedPoints points(N, 3);
+        for (int i = 0; i < N; i++)
+        {
+            points.row(i) << pts[i].x, pts[i].y, pts[i].z;
+        }
+
+        const int num_pts = std::min(N, 3);
+        FixedPoints p(num_pts, 3);
+        FixedPoints q(num_pts, 3);
+        FixedPoints rot_points(N, 3);
+        std::array<unsigned int, max_fixed_points> assignment;
+        std::array<unsigned int, max_fixed_points> best_assignment {};
+        Eigen::Matrix3d best_rotation = Eigen::Matrix3d::Identity();
+
+        RandomNumber<std::mt19937_64> rng;
+        double rmsd_min = -1.0;
+        for (size_t shuffles = 0; shuffles < m_shuffles && !(rmsd_min >= 0.0 && rmsd_min < m_tol);
+             shuffles++)
+        {
+            // pick distinct random reference points
+            std::array<int, 3> picks {};
+            for (int k = 0; k < num_pts; k++)
+            {
+                bool repeated = true;
+                while (repeated)
+                {
+                    picks[k] = rng.random_int(0, N - 1);
+                    repeated = std::find(picks.begin(), picks.begin() + k, picks[k]) != picks.begin() + k;
+                }
+                p.row(k) = ref_points.row(picks[k]);
+            }
+
+            // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+            size_t comb[3] = {0, 1, 2};
+            bool converged = false;
+            do
+            {
+                do
+                {
+                    for (int k = 0; k < num_pts; k++)
+                    {
+                        q.row(k) = points.row(comb[k]);
+                    }
+
+                    // finds the optimal rotation of the points such that
+                    // the chosen ones match the chosen reference points
+                    const Eigen::Matrix3d r = HornRotation(q, p);
+                    rot_points.noalias() = points * r.transpose();
+
+                    const double rmsd = std::sqrt(HungarianAssignment(ref_points, rot_points, assignment)
+                                                  / static_cast<double>(N));
+                    if (rmsd < rmsd_min || rmsd_min < 0.0)
+                    {
+                        rmsd_min = rmsd;
+                        best_rotation = r;
+                        best_assignment = assignment;
+                        converged = rmsd_min < m_tol;
+                    }
+                } while (!converged && std::next_permutation(comb, comb + num_pts));
+            } while (!converged && NextCombination(comb, N, num_pts));
+        } // end for loop over shuffles
+
+        m_rmsd = static_cast<float>(rmsd_min);
+        m_rotation = best_rotation;
+        m_vec_map = makeVecMap(best_assignment, N);
+        rot_points.noalias() = points * best_rotation.transpose();
+        for (int i = 0; i < N; i++)
+        {
+            pts[i] = make_point(rot_points.row(i).transpose());
+        }
+    }
+
+    //! Convert an assignment of points to reference points to a mapping of reference points to points.
+    static BiMap<unsigned int, unsigned int>
+    makeVecMap(const std::array<unsigned int, max_fixed_points>& assignment, unsigned int N)
+    {
+        BiMap<unsigned int, unsigned int> vec_map;
+        for (unsigned int r = 0; r < N; r++)
+        {
+            vec_map.emplace(assignment[r], r);
+        }
+        return vec_map;
+    }
+
     static vec3<float> make_point(const Eigen::VectorXd& row)
     {
         if (row.rows() == 2)
@@ -1,6 +1,9 @@
 #ifndef HISTOGRAM_COMPUTE_H
 #define HISTOGRAM_COMPUTE_H
 
+#include <stdexcept>
+
+#include "AABBQuery.h"
 #include "Box.h"
 #include "Histogram.h"
 #include "NeighborComputeFunctional.h"
@@ -29,10 +32,36 @@ public:
     virtual void reset()
     {
         m_local_histograms.reset();
+        if (m_tile_size != 0)
+        {
+            // The dense bin counts are allocated again when they are requested.
+            m_histogram.prepare(0);
+        }
         m_frame_counter = 0;
         m_reduce = true;
     }
 
+    //! Set the number of bins per tile of the thread local histograms.
+    /*! With a nonzero tile size, each thread allocates tiles of consecutive
+     *  bins only when it first counts a bond in them, so memory use during
+     *  accumulation is bound by the occupied bins rather than the resolution
+     *  of the histogram. Dense arrays are only created when results are
+     *  requested. A tile size of 0 restores dense storage. Any accumulated
+     *  data is discarded.
+     */
+    void setTileSize(size_t tile_size)
+    {
+        m_tile_size = tile_size;
+        m_local_histograms = BondHistogram::ThreadLocalHistogram(m_histogram, tile_size);
+        reset();
+    }
+
+    //! Get the number of bins per tile of the thread local histograms, or 0 for dense storage.
+    size_t getTileSize() const
+    {
+        return m_tile_size;
+    }
+
     //! Reduce thread-local arrays onto the primary data arrays.
     virtual void reduce() = 0;
 
@@ -102,20 +131,73 @@ public:
                            unsigned int n_query_points, const locality::NeighborList* nlist,
                            locality::QueryArgs qargs, Func cf)
     {
-        m_box = neighbor_query->getBox();
         locality::loopOverNeighbors(neighbor_query, query_points, n_query_points, qargs, nlist, cf);
-        m_frame_counter++;
-        m_n_points = neighbor_query->getNPoints();
-        m_n_query_points = n_query_points;
+        // Frames of a trajectory are counted together once all of them are accumulated.
+        if (!m_accumulating_trajectory)
+        {
+            m_box = neighbor_query->getBox();
+            m_frame_counter++;
+            m_n_points = neighbor_query->getNPoints();
+            m_n_query_points = n_query_points;
+            m_reduce = true;
+        }
+    }
+
+    //! \internal
+    // Wrapper to accumulate all frames of a trajectory in a single call.
+    /*! Frames are accumulated in parallel, and the bonds of each frame are
+        found in parallel by querying an AABBQuery of its points with the
+        points themselves. The result is the same as accumulating the frames
+        one at a time, so the box of the last frame is used for normalization.
+
+        \param boxes The box of each frame.
+        \param points The points of all frames, with n_points consecutive points per frame.
+        \param n_frames Number of frames.
+        \param n_points Number of points in each frame.
+        \param accumulate_frame An object with operator(const NeighborQuery*, size_t frame) that
+           accumulates a single frame, usually by calling the accumulate method of the subclass
+           with the points of the NeighborQuery as the query points.
+    */
+    template<typename Func>
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points, unsigned int n_frames,
+                              unsigned int n_points, Func accumulate_frame)
+    {
+        if (n_frames == 0)
+        {
+            throw std::invalid_argument("A trajectory must contain at least one frame.");
+        }
+        m_accumulating_trajectory = true;
+        try
+        {
+            util::forLoopWrapper(0, n_frames, [&](size_t begin, size_t end) {
+                for (size_t frame = begin; frame < end; ++frame)
+                {
+                    const AABBQuery neighbor_query(boxes[frame], points + frame * n_points, n_points);
+                    accumulate_frame(&neighbor_query, frame);
+                }
+            });
+        }
+        catch (...)
+        {
+            m_accumulating_trajectory = false;
+            throw;
+        }
+        m_accumulating_trajectory = false;
+        m_box = boxes[n_frames - 1];
+        m_frame_counter += n_frames;
+        m_n_points = n_points;
+        m_n_query_points = n_points;
         m_reduce = true;
     }
 
 protected:
     box::Box m_box;
-    unsigned int m_frame_counter {0};  //!< Number of frames calculated.
-    unsigned int m_n_points {0};       //!< The number of points.
-    unsigned int m_n_query_points {0}; //!< The number of query points.
-    bool m_reduce {true};              //!< Whether or not the histogram needs to be reduced.
+    unsigned int m_frame_counter {0};       //!< Number of frames calculated.
+    unsigned int m_n_points {0};            //!< The number of points.
+    unsigned int m_n_query_points {0};      //!< The number of query points.
+    bool m_reduce {true};                   //!< Whether or not the histogram needs to be reduced.
+    size_t m_tile_size {0};                 //!< Number of bins per tile of the thread local histograms.
+    bool m_accumulating_trajectory {false}; //!< Whether frames are being accumulated in parallel.
 
     util::Histogram<unsigned int> m_histogram; //!< Histogram of interparticle distances (bond lengths).
     util::Histogram<unsigned int>::ThreadLocalHistogram
@@ -0,0 +1,103 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+#include "FFT.h"
+#include "MSD.h"
+#include "utils.h"
+
+/*! \file MSD.cc
+    \brief Routines for computing mean squared displacements.
+*/
+
+namespace freud { namespace msd {
+
+void MSD::compute(const vec3<float>* positions, const vec3<int>* images, const box::Box& box,
+                  unsigned int n_frames, unsigned int n_particles)
+{
+    if (n_frames == 0)
+    {
+        throw std::invalid_argument("MSD requires at least one frame.");
+    }
+    m_particle_msd.prepare({n_frames, n_particles});
+
+    // Zero padding to at least twice the number of frames turns the circular
+    // correlation computed with FFTs into a linear correlation.
+    const size_t fft_size = util::nextPowerOfTwo(2 * size_t(n_frames));
+
+    util::forLoopWrapper(0, n_particles, [&](size_t begin, size_t end) {
+        std::vector<vec3<double>> r(n_frames);
+        std::vector<double> squared_norms(n_frames);
+        std::vector<std::complex<double>> xy;
+        std::vector<std::complex<double>> z;
+        if (m_mode == Window)
+        {
+            xy.resize(fft_size);
+            z.resize(fft_size);
+        }
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            // Gather and unwrap the trajectory of this particle.
+            for (size_t t = 0; t < n_frames; ++t)
+            {
+                const size_t index = t * n_particles + i;
+                const vec3<float> position
+                    = (images != nullptr) ? box.unwrap(positions[index], images[index]) : positions[index];
+                r[t] = vec3<double>(position.x, position.y, position.z);
+            }
+
+            if (m_mode == Direct)
+            {
+                for (size_t t = 0; t < n_frames; ++t)
+                {
+                    const vec3<double> delta = r[t] - r[0];
+                    m_particle_msd[t * n_particles + i] = dot(delta, delta);
+                }
+                continue;
+            }
+
+            // The autocorrelation of the positions over time, summed over the
+            // components.
+            for (size_t t = 0; t < n_frames; ++t)
+            {
+                xy[t] = std::complex<double>(r[t].x, r[t].y);
+                z[t] = std::complex<double>(r[t].z, 0);
+                squared_norms[t] = dot(r[t], r[t]);
+            }
+            std::fill(xy.begin() + n_frames, xy.end(), std::complex<double>(0, 0));
+            std::fill(z.begin() + n_frames, z.end(), std::complex<double>(0, 0));
+            util::fft(xy.data(), fft_size);
+            util::fft(z.data(), fft_size);
+            for (size_t k = 0; k < fft_size; ++k)
+            {
+                xy[k] = std::norm(xy[k]) + std::norm(z[k]);
+            }
+            util::fft(xy.data(), fft_size, true);
+
+            // The sum of r^2(k + m) + r^2(k) over all windows, updated from
+            // one lag to the next by removing the terms that leave the window.
+            double sum_squared_norms = 0;
+            for (size_t t = 0; t < n_frames; ++t)
+            {
+                sum_squared_norms += 2 * squared_norms[t];
+            }
+            for (size_t m = 0; m < n_frames; ++m)
+            {
+                if (m > 0)
+                {
+                    sum_squared_norms -= squared_norms[m - 1] + squared_norms[n_frames - m];
+                }
+                const double num_windows = n_frames - m;
+                m_particle_msd[m * n_particles + i]
+                    = (sum_squared_norms - 2 * xy[m].real()) / num_windows;
+            }
+        }
+    });
+}
+
+}; }; // end namespace freud::msd
@@ -0,0 +1,76 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef MSD_H
+#define MSD_H
+
+#include "Box.h"
+#include "ManagedArray.h"
+#include "VectorMath.h"
+
+/*! \file MSD.h
+    \brief Routines for computing mean squared displacements.
+*/
+
+namespace freud { namespace msd {
+
+enum MSDMode
+{
+    Window,
+    Direct
+};
+
+//! Compute the mean squared displacement of each particle over a trajectory
+/*! In Window mode, the displacement for a lag of m frames is averaged over all
+    windows of m frames in the trajectory, using the algorithm of Calandrini et
+    al. (nMoldyn): the sum of squared positions is accumulated directly, and the
+    correlation of positions over time is computed with fast Fourier
+    transforms. The x and y components of each particle are transformed
+    together as the real and imaginary parts of a single complex sequence, since
+    the real part of its autocorrelation is the sum of their autocorrelations.
+
+    In Direct mode, the displacement of each frame is measured from the first
+    frame.
+
+    Particles are processed in parallel, and each thread only allocates the
+    buffers for a single particle, so the memory used beyond the input and the
+    result does not depend on the number of particles.
+*/
+class MSD
+{
+public:
+    //! Constructor
+    explicit MSD(MSDMode mode = Window) : m_mode(mode) {}
+
+    //! Compute the MSD of each particle
+    /*! \param positions Positions of shape (n_frames, n_particles).
+     *  \param images Optional image flags of the same shape as positions, used
+     *         with box to unwrap the positions. Positions are assumed to be
+     *         unwrapped if images is nullptr.
+     *  \param box Box used to unwrap the positions.
+     *  \param n_frames Number of frames.
+     *  \param n_particles Number of particles.
+     */
+    void compute(const vec3<float>* positions, const vec3<int>* images, const box::Box& box,
+                 unsigned int n_frames, unsigned int n_particles);
+
+    //! Get a reference to the MSD of each particle, of shape (n_frames, n_particles)
+    const util::ManagedArray<double>& getParticleMSD() const
+    {
+        return m_particle_msd;
+    }
+
+    //! Get the mode of the calculation
+    MSDMode getMode() const
+    {
+        return m_mode;
+    }
+
+private:
+    MSDMode m_mode;                            //!< Mode of the calculation
+    util::ManagedArray<double> m_particle_msd; //!< MSD of each particle
+};
+
+}; }; // end namespace freud::msd
+
+#endif // MSD_H
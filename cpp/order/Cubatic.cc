@@ -1,10 +1,13 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <functional>
 #include <stdexcept>
 #include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
 
 #include "Cubatic.h"
@@ -71,7 +74,7 @@ tensor4 tensor4::operator*(const float& b) const
     return c;
 }
 
-void tensor4::copyToManagedArray(util::ManagedArray<float>& ma)
+void tensor4::copyToManagedArray(util::ManagedArray<float>& ma) const
 {
     std::copy(data.begin(), data.end(), ma.get());
 }
@@ -131,8 +134,242 @@ tensor4 genR4Tensor()
     return r4;
 }
 
-Cubatic::Cubatic(float t_initial, float t_final, float scale, unsigned int n_replicates, unsigned int seed)
-    : m_t_initial(t_initial), m_t_final(t_final), m_scale(scale), m_n_replicates(n_replicates), m_seed(seed)
+namespace {
+
+//! A frame of three orthonormal axes, given by the rotated basis vectors.
+using Frame = std::array<vec3<double>, 3>;
+
+//! Symmetric quartic form T(u, u, u, u) of a rank 4 tensor, in double precision.
+class QuarticForm
+{
+public:
+    explicit QuarticForm(const tensor4& tensor)
+    {
+        std::copy(tensor.data.begin(), tensor.data.end(), m_data.begin());
+    }
+
+    //! Contract three indices with u, giving the vector T(u, u, u, .).
+    vec3<double> contract(const vec3<double>& u) const
+    {
+        const std::array<double, 3> v = {u.x, u.y, u.z};
+        std::array<double, 3> result = {0, 0, 0};
+        unsigned int cnt = 0;
+        for (double vi : v)
+        {
+            for (double vj : v)
+            {
+                const double vij = vi * vj;
+                for (double vk : v)
+                {
+                    const double vijk = vij * vk;
+                    for (double& result_l : result)
+                    {
+                        result_l += m_data[cnt] * vijk;
+                        ++cnt;
+                    }
+                }
+            }
+        }
+        return {result[0], result[1], result[2]};
+    }
+
+    //! Evaluate T(u, u, u, u).
+    double operator()(const vec3<double>& u) const
+    {
+        return dot(contract(u), u);
+    }
+
+    //! Sum of the quartic form over the axes of a frame.
+    double operator()(const Frame& frame) const
+    {
+        double value = 0;
+        for (const auto& u : frame)
+        {
+            value += (*this)(u);
+        }
+        return value;
+    }
+
+private:
+    std::array<double, 81> m_data {};
+};
+
+//! Rotate a vector by the rotation vector omega (axis times angle).
+vec3<double> rotateByVector(const vec3<double>& v, const vec3<double>& omega)
+{
+    const double angle = std::sqrt(dot(omega, omega));
+    if (angle == 0)
+    {
+        return v;
+    }
+    const vec3<double> axis = omega / angle;
+    return v * std::cos(angle) + cross(axis, v) * std::sin(angle)
+        + axis * (dot(axis, v) * (1 - std::cos(angle)));
+}
+
+//! Find a local maximum of the quartic form on the unit sphere by power iteration.
+/*! The quartic form of a sum of fourth tensor powers is convex, so each
+ *  iteration does not decrease its value.
+ */
+vec3<double> maximizeAxis(const QuarticForm& form, vec3<double> u)
+{
+    u /= std::sqrt(dot(u, u));
+    for (unsigned int iteration = 0; iteration < 200; ++iteration)
+    {
+        const vec3<double> t = form.contract(u);
+        const double norm = std::sqrt(dot(t, t));
+        if (norm == 0)
+        {
+            break;
+        }
+        const vec3<double> new_u = t / norm;
+        const vec3<double> change = new_u - u;
+        u = new_u;
+        if (dot(change, change) < 1e-24)
+        {
+            break;
+        }
+    }
+    return u;
+}
+
+//! Complete a frame from its first axis by scanning the orthogonal plane.
+Frame completeFrame(const QuarticForm& form, const vec3<double>& u1)
+{
+    // Any vector orthogonal to u1 spans the plane together with u1 x a.
+    const vec3<double> helper = std::abs(u1.x) < 0.5 ? vec3<double>(1, 0, 0) : vec3<double>(0, 1, 0);
+    vec3<double> a = cross(u1, helper);
+    a /= std::sqrt(dot(a, a));
+    const vec3<double> b = cross(u1, a);
+
+    // The quartic form has period pi in the plane.
+    constexpr unsigned int num_angles = 90;
+    vec3<double> u2 = a;
+    double best_value = form(a);
+    for (unsigned int k = 1; k < num_angles; ++k)
+    {
+        const double angle = M_PI * k / num_angles;
+        const vec3<double> u = a * std::cos(angle) + b * std::sin(angle);
+        const double value = form(u);
+        if (value > best_value)
+        {
+            best_value = value;
+            u2 = u;
+        }
+    }
+    return {u1, u2, cross(u1, u2)};
+}
+
+//! Maximize the sum of the quartic form over a frame by gradient ascent on rotations.
+Frame refineFrame(const QuarticForm& form, Frame frame)
+{
+    double value = form(frame);
+    double step = 0;
+    for (unsigned int iteration = 0; iteration < 1000; ++iteration)
+    {
+        // Rotating every axis by omega changes the value by omega . gradient.
+        vec3<double> gradient(0, 0, 0);
+        for (const auto& u : frame)
+        {
+            gradient += cross(u, form.contract(u)) * 4.0;
+        }
+        const double gradient_norm = std::sqrt(dot(gradient, gradient));
+        if (gradient_norm == 0)
+        {
+            break;
+        }
+        if (step == 0)
+        {
+            // Start with a rotation of 0.1 radians.
+            step = 0.1 / gradient_norm;
+        }
+
+        // Adapt the step until the value increases.
+        bool improved = false;
+        while (!improved && step * gradient_norm > 1e-9)
+        {
+            Frame trial;
+            for (unsigned int a = 0; a < 3; ++a)
+            {
+                trial[a] = rotateByVector(frame[a], gradient * step);
+            }
+            const double trial_value = form(trial);
+            if (trial_value > value)
+            {
+                frame = trial;
+                value = trial_value;
+                improved = true;
+                step *= 1.5;
+            }
+            else
+            {
+                step *= 0.5;
+            }
+        }
+        if (!improved)
+        {
+            break;
+        }
+    }
+
+    // Remove accumulated round-off from the orthonormality of the frame.
+    frame[0] /= std::sqrt(dot(frame[0], frame[0]));
+    frame[1] -= frame[0] * dot(frame[0], frame[1]);
+    frame[1] /= std::sqrt(dot(frame[1], frame[1]));
+    frame[2] = cross(frame[0], frame[1]);
+    return frame;
+}
+
+//! Quaternion of the rotation taking the Euclidean basis vectors to the axes of a frame.
+quat<float> frameToQuaternion(const Frame& frame)
+{
+    // Rotation matrix with the frame axes as columns, R(i, j) = frame[j][i].
+    const double r00 = frame[0].x;
+    const double r10 = frame[0].y;
+    const double r20 = frame[0].z;
+    const double r01 = frame[1].x;
+    const double r11 = frame[1].y;
+    const double r21 = frame[1].z;
+    const double r02 = frame[2].x;
+    const double r12 = frame[2].y;
+    const double r22 = frame[2].z;
+
+    const double trace = r00 + r11 + r22;
+    double s;
+    vec3<double> v;
+    if (trace > 0)
+    {
+        const double f = 2 * std::sqrt(trace + 1);
+        s = f / 4;
+        v = vec3<double>((r21 - r12) / f, (r02 - r20) / f, (r10 - r01) / f);
+    }
+    else if (r00 > r11 && r00 > r22)
+    {
+        const double f = 2 * std::sqrt(1 + r00 - r11 - r22);
+        s = (r21 - r12) / f;
+        v = vec3<double>(f / 4, (r01 + r10) / f, (r02 + r20) / f);
+    }
+    else if (r11 > r22)
+    {
+        const double f = 2 * std::sqrt(1 + r11 - r00 - r22);
+        s = (r02 - r20) / f;
+        v = vec3<double>((r01 + r10) / f, f / 4, (r12 + r21) / f);
+    }
+    else
+    {
+        const double f = 2 * std::sqrt(1 + r22 - r00 - r11);
+        s = (r10 - r01) / f;
+        v = vec3<double>((r02 + r20) / f, (r12 + r21) / f, f / 4);
+    }
+    return quat<float>(float(s), vec3<float>(float(v.x), float(v.y), float(v.z)));
+}
+
+}; // end anonymous namespace
+
+Cubatic::Cubatic(float t_initial, float t_final, float scale, unsigned int n_replicates, unsigned int seed,
+                 CubaticOptimizer optimizer)
+    : m_t_initial(t_initial), m_t_final(t_final), m_scale(scale), m_n_replicates(n_replicates), m_seed(seed),
+      m_optimizer(optimizer)
 {
     if (m_t_initial < m_t_final)
     {
@@ -158,7 +395,7 @@ Cubatic::Cubatic(float t_initial, float t_final, float scale, unsigned int n_rep
     m_system_vectors[2] = vec3<float>(0, 0, 1);
 }
 
-tensor4 Cubatic::calcCubaticTensor(quat<float>& orientation)
+tensor4 Cubatic::calcCubaticTensor(const quat<float>& orientation) const
 {
     tensor4 calculated_tensor = tensor4();
     for (auto& m_system_vector : m_system_vectors)
@@ -186,81 +423,69 @@ template<typename T> quat<float> Cubatic::calcRandomQuaternion(T& dist, float an
     return quat<float>::fromAxisAngle(axis, angle);
 }
 
-util::ManagedArray<tensor4> Cubatic::calculatePerParticleTensor(const quat<float>* orientations) const
+tensor4 Cubatic::calculateGlobalTensor(const quat<float>* orientations) const
 {
-    util::ManagedArray<tensor4> particle_tensor(m_n);
+    // Each thread sums all 81 components of the homogeneous tensors, one term
+    // per particle and system vector, in double.
+    using TensorSum = std::array<double, 81>;
+    tbb::enumerable_thread_specific<TensorSum> thread_sums(TensorSum {});
 
-    // calculate per-particle tensor
-    util::forLoopWrapper(0, m_n, [=, &particle_tensor](size_t begin, size_t end) {
+    util::forLoopWrapper(0, m_n, [=, &thread_sums](size_t begin, size_t end) {
+        TensorSum& local_sum = thread_sums.local();
         for (size_t i = begin; i < end; ++i)
         {
-            tensor4 l_mbar = tensor4();
             for (const auto& m_system_vector : m_system_vectors)
             {
-                // Calculate the homogeneous tensor H for each vector then add
-                // to the per-particle value.
-                vec3<float> v_r = rotate(orientations[i], m_system_vector);
-                tensor4 r4_tensor(v_r);
-                l_mbar += r4_tensor;
+                // Add the homogeneous tensor H of each rotated vector directly
+                // to the running sum.
+                const vec3<float> v_r = rotate(orientations[i], m_system_vector);
+                const std::array<float, 3> v = {v_r.x, v_r.y, v_r.z};
+                unsigned int cnt = 0;
+                for (float vi : v)
+                {
+                    for (float vj : v)
+                    {
+                        const float vij = vi * vj;
+                        for (float vk : v)
+                        {
+                            const float vijk = vij * vk;
+                            for (float vl : v)
+                            {
+                                local_sum[cnt] += vijk * vl;
+                                cnt++;
+                            }
+                        }
+                    }
+                }
             }
-
-            // Apply the prefactor from the sum in equation 27 before assigning.
-            particle_tensor[i] = l_mbar * 2.0;
         }
     });
-    return particle_tensor;
-}
 
-tensor4 Cubatic::calculateGlobalTensor(quat<float>* orientations) const
-{
+    // Apply the 2/N prefactor of the third equation in eq. 27.
+    const double prefactor = 2.0 / static_cast<double>(m_n);
     tensor4 global_tensor = tensor4();
-    util::ManagedArray<tensor4> particle_tensor = calculatePerParticleTensor(orientations);
-
-    // now calculate the global tensor
-    float n_inv = float(1.0) / static_cast<float>(m_n);
-
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, 81),
-                      [=, &global_tensor, &n_inv, &particle_tensor](const tbb::blocked_range<size_t>& r) {
-                          for (size_t i = r.begin(); i != r.end(); i++)
-                          {
-                              float tensor_value = 0;
-                              for (unsigned int j = 0; j < m_n; j++)
-                              {
-                                  tensor_value += particle_tensor[j][i];
-                              }
-                              // Note that in the third equation in eq. 27, the prefactor of the
-                              // sum is 2/N, but the factor of 2 is already accounted for in the
-                              // calculation of per particle calculation in
-                              // calculatePerParticleTensor, so here we just need to apply the
-                              // 1/N scaling.
-                              global_tensor[i] = tensor_value * n_inv;
-                          }
-                      });
+    for (const TensorSum& local_sum : thread_sums)
+    {
+        for (unsigned int i = 0; i < 81; i++)
+        {
+            global_tensor[i] += static_cast<float>(local_sum[i] * prefactor);
+        }
+    }
     return global_tensor - m_gen_r4_tensor;
 }
 
-void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
+quat<float> Cubatic::optimizeAnnealing(const tensor4& global_tensor) const
 {
-    m_n = num_orientations;
-    m_particle_order_parameter.prepare(m_n);
-
-    // Calculate the per-particle tensor
-    tensor4 global_tensor = calculateGlobalTensor(orientations);
-    m_global_tensor.prepare({3, 3, 3, 3});
-    global_tensor.copyToManagedArray(m_global_tensor);
-
     // The paper recommends using a Newton-Raphson scheme to optimize the order
     // parameter, but in practice we find that simulated annealing performs
     // much better, so we perform replicates of the process and choose the best
     // one.
-    util::ManagedArray<tensor4> p_cubatic_tensor(m_n_replicates);
     util::ManagedArray<float> p_cubatic_order_parameter(m_n_replicates);
     util::ManagedArray<quat<float>> p_cubatic_orientation(m_n_replicates);
 
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, m_n_replicates),
-        [=, &p_cubatic_orientation, &p_cubatic_order_parameter,
-         &p_cubatic_tensor](const tbb::blocked_range<size_t>& r) {
+        [=, &p_cubatic_orientation, &p_cubatic_order_parameter](const tbb::blocked_range<size_t>& r) {
             // create thread-specific rng
             unsigned int thread_start = r.begin();
 
@@ -280,8 +505,8 @@ void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
                 quat<float> new_orientation = cubatic_orientation;
 
                 // now calculate the cubatic tensor
-                tensor4 cubatic_tensor = calcCubaticTensor(cubatic_orientation);
-                float cubatic_order_parameter = calcCubaticOrderParameter(cubatic_tensor, global_tensor);
+                float cubatic_order_parameter
+                    = calcCubaticOrderParameter(calcCubaticTensor(cubatic_orientation), global_tensor);
                 float new_order_parameter = cubatic_order_parameter;
 
                 // set initial temperature and count
@@ -297,7 +522,6 @@ void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
                     new_order_parameter = calcCubaticOrderParameter(new_cubatic_tensor, global_tensor);
                     if (new_order_parameter > cubatic_order_parameter)
                     {
-                        cubatic_tensor = new_cubatic_tensor;
                         cubatic_order_parameter = new_order_parameter;
                         cubatic_orientation = new_orientation;
                     }
@@ -307,7 +531,6 @@ void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
                             = std::exp(-(cubatic_order_parameter - new_order_parameter) / t_current);
                         if (boltzmann_factor >= dist())
                         {
-                            cubatic_tensor = new_cubatic_tensor;
                             cubatic_order_parameter = new_order_parameter;
                             cubatic_orientation = new_orientation;
                         }
@@ -319,7 +542,6 @@ void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
                     t_current *= m_scale;
                 }
                 // set values
-                p_cubatic_tensor[i] = cubatic_tensor;
                 p_cubatic_orientation[i].s = cubatic_orientation.s;
                 p_cubatic_orientation[i].v = cubatic_orientation.v;
                 p_cubatic_order_parameter[i] = cubatic_order_parameter;
@@ -338,14 +560,102 @@ void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations)
         }
     }
 
+    return p_cubatic_orientation[max_idx];
+}
+
+quat<float> Cubatic::optimizeGradient(const tensor4& global_tensor) const
+{
+    // Adding back the r4 tensor leaves a sum of fourth tensor powers, whose
+    // quartic form differs from that of \bar{M} by a constant on unit vectors.
+    tensor4 power_sum = global_tensor;
+    power_sum += m_gen_r4_tensor;
+    const QuarticForm form(power_sum);
+
+    // Power iteration from the cubic axes, face diagonals, and body diagonals.
+    const std::array<vec3<double>, 13> starts = {
+        vec3<double>(1, 0, 0),  vec3<double>(0, 1, 0),  vec3<double>(0, 0, 1),  vec3<double>(1, 1, 0),
+        vec3<double>(1, -1, 0), vec3<double>(1, 0, 1),  vec3<double>(1, 0, -1), vec3<double>(0, 1, 1),
+        vec3<double>(0, 1, -1), vec3<double>(1, 1, 1),  vec3<double>(1, 1, -1), vec3<double>(1, -1, 1),
+        vec3<double>(-1, 1, 1)};
+    std::vector<std::pair<double, vec3<double>>> axes;
+    for (const auto& start : starts)
+    {
+        const vec3<double> u = maximizeAxis(form, start);
+        const bool is_new = std::none_of(axes.begin(), axes.end(), [&u](const auto& axis) {
+            return std::abs(dot(axis.second, u)) > 0.999;
+        });
+        if (is_new)
+        {
+            axes.emplace_back(form(u), u);
+        }
+    }
+    std::sort(axes.begin(), axes.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    // Refine frames built from the best few axes, as well as the identity.
+    constexpr unsigned int max_num_frames = 3;
+    std::vector<Frame> frames = {{vec3<double>(1, 0, 0), vec3<double>(0, 1, 0), vec3<double>(0, 0, 1)}};
+    for (unsigned int i = 0; i < std::min<size_t>(axes.size(), max_num_frames); ++i)
+    {
+        frames.push_back(completeFrame(form, axes[i].second));
+    }
+
+    Frame best_frame = refineFrame(form, frames[0]);
+    double best_value = form(best_frame);
+    for (size_t i = 1; i < frames.size(); ++i)
+    {
+        const Frame frame = refineFrame(form, frames[i]);
+        const double value = form(frame);
+        if (value > best_value)
+        {
+            best_value = value;
+            best_frame = frame;
+        }
+    }
+    return frameToQuaternion(best_frame);
+}
+
+void Cubatic::compute(quat<float>* orientations, unsigned int num_orientations, bool compute_particle_order)
+{
+    m_n = num_orientations;
+
+    tensor4 global_tensor = calculateGlobalTensor(orientations);
+    m_global_tensor.prepare({3, 3, 3, 3});
+    global_tensor.copyToManagedArray(m_global_tensor);
+
+    if (m_optimizer == GradientAscent)
+    {
+        m_cubatic_orientation = optimizeGradient(global_tensor);
+    }
+    else
+    {
+        m_cubatic_orientation = optimizeAnnealing(global_tensor);
+    }
+
+    const tensor4 cubatic_tensor = calcCubaticTensor(m_cubatic_orientation);
     m_cubatic_tensor.prepare({3, 3, 3, 3});
-    p_cubatic_tensor[max_idx].copyToManagedArray(m_cubatic_tensor);
-    m_cubatic_orientation = p_cubatic_orientation[max_idx];
-    m_cubatic_order_parameter = p_cubatic_order_parameter[max_idx];
+    cubatic_tensor.copyToManagedArray(m_cubatic_tensor);
+    m_cubatic_order_parameter = calcCubaticOrderParameter(cubatic_tensor, global_tensor);
+
+    if (compute_particle_order)
+    {
+        computeParticleOrderParameter(orientations);
+    }
+    else
+    {
+        m_particle_order_parameter.prepare(0);
+    }
+}
 
-    // Now calculate the per-particle order parameters
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_n), [=](const tbb::blocked_range<size_t>& r) {
-        for (size_t i = r.begin(); i != r.end(); i++)
+void Cubatic::computeParticleOrderParameter(const quat<float>* orientations)
+{
+    m_particle_order_parameter.prepare(m_n);
+
+    tensor4 global_tensor;
+    std::copy(m_global_tensor.get(), m_global_tensor.get() + 81, global_tensor.data.begin());
+
+    util::forLoopWrapper(0, m_n, [=](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
         {
             // The per-particle order parameter is defined as the value of the
             // cubatic order parameter if the global orientation was the
@@ -31,11 +31,18 @@ struct tensor4
     tensor4 operator*(const float& b) const;
     float& operator[](unsigned int index);
 
-    void copyToManagedArray(util::ManagedArray<float>& ma);
+    void copyToManagedArray(util::ManagedArray<float>& ma) const;
 
     std::array<float, 81> data {0};
 };
 
+//! Method used to find the orientation that maximizes the cubatic order parameter.
+enum CubaticOptimizer
+{
+    SimulatedAnnealing, //!< Replicated simulated annealing over random rotations.
+    GradientAscent      //!< Deterministic tensor power iteration and gradient refinement.
+};
+
 //! Compute the cubatic order parameter for a set of points
 /*! The cubatic order parameter is defined according to the paper "Strong
  * orientational coordinates and orientational order parameters for symmetric
@@ -56,7 +63,11 @@ class Cubatic
 {
 public:
     //! Constructor
-    Cubatic(float t_initial, float t_final, float scale, unsigned int replicates, unsigned int seed);
+    /*! The temperatures, scale, replicates, and seed are only used by the
+     *  SimulatedAnnealing optimizer.
+     */
+    Cubatic(float t_initial, float t_final, float scale, unsigned int replicates, unsigned int seed,
+            CubaticOptimizer optimizer = SimulatedAnnealing);
 
     //! Destructor
     ~Cubatic() = default;
@@ -65,7 +76,19 @@ public:
     void reset();
 
     //! Compute the cubatic order parameter
-    void compute(quat<float>* orientations, unsigned int num_orientations);
+    /*! \param orientations Particle orientations.
+     *  \param num_orientations Number of orientations.
+     *  \param compute_particle_order Whether to also compute the per-particle
+     *         order parameter. If false, it may be computed later with
+     *         computeParticleOrderParameter.
+     */
+    void compute(quat<float>* orientations, unsigned int num_orientations,
+                 bool compute_particle_order = true);
+
+    //! Compute the per-particle order parameter.
+    /*! Must be called after compute with the same orientations.
+     */
+    void computeParticleOrderParameter(const quat<float>* orientations);
 
     unsigned int getNumParticles() const
     {
@@ -123,6 +146,11 @@ public:
         return m_seed;
     }
 
+    CubaticOptimizer getOptimizer() const
+    {
+        return m_optimizer;
+    }
+
 private:
     //! Calculate the cubatic tensor
     /*! Implements the second line of eq. 27, the calculation of M_{\omega}.
@@ -132,7 +160,7 @@ private:
      *
      *  \return The cubatic tensor M_{\omega}.
      */
-    tensor4 calcCubaticTensor(quat<float>& orientation);
+    tensor4 calcCubaticTensor(const quat<float>& orientation) const;
 
     //! Calculate the scalar cubatic order parameter.
     /*! Implements eq. 22.
@@ -144,19 +172,35 @@ private:
      */
     static float calcCubaticOrderParameter(const tensor4& cubatic_tensor, const tensor4& global_tensor);
 
-    //! Calculate the per-particle tensor.
-    /*! Implements the first line of eq. 27, the calculation of M.
-     *
-     *  \param orientations The per-particle orientations.
-     *
-     *  \return The per-particle cubatic tensors value M^{ijkl}.
+    //! Calculate the global tensor for the system.
+    /*! Implements the first and third lines of eq. 27, the calculation of
+     *  \bar{M}. The per-particle tensors M are summed into per-thread
+     *  accumulators as they are generated rather than being stored.
      */
-    util::ManagedArray<tensor4> calculatePerParticleTensor(const quat<float>* orientations) const;
+    tensor4 calculateGlobalTensor(const quat<float>* orientations) const;
 
-    //! Calculate the global tensor for the system.
-    /*! Implements the third line of eq. 27, the calculation of \bar{M}.
+    //! Find the cubatic orientation by replicated simulated annealing.
+    /*! \param global_tensor The tensor encoding the average system orientation (denoted \bar{M}).
+     *
+     *  \return The best orientation found.
+     */
+    quat<float> optimizeAnnealing(const tensor4& global_tensor) const;
+
+    //! Find the cubatic orientation deterministically.
+    /*! Since the norm of M_{\omega} does not depend on the orientation,
+     *  maximizing eq. 22 is equivalent to maximizing the contraction of
+     *  \bar{M} with M_{\omega}, i.e. the sum over the three rotated basis
+     *  vectors u of the quartic form \bar{M}(u, u, u, u). Candidate first axes
+     *  are found by power iteration of the quartic form from a few fixed
+     *  directions, the second axis by a scan of the quartic form in the
+     *  orthogonal plane, and each resulting frame is refined by gradient
+     *  ascent on the rotation group.
+     *
+     *  \param global_tensor The tensor encoding the average system orientation (denoted \bar{M}).
+     *
+     *  \return The best orientation found.
      */
-    tensor4 calculateGlobalTensor(quat<float>* orientations) const;
+    quat<float> optimizeGradient(const tensor4& global_tensor) const;
 
     //! Calculate a random quaternion.
     /*! To calculate a random quaternion in a way that obeys the right
@@ -172,6 +216,7 @@ private:
     float m_scale;               //!< Scaling factor to reduce temperature.
     unsigned int m_n_replicates; //!< Number of replicates.
     unsigned int m_seed;         //!< Random seed.
+    CubaticOptimizer m_optimizer; //!< Method used to optimize the cubatic orientation.
     unsigned int m_n {0};        //!< Last number of points computed.
 
     float m_cubatic_order_parameter {0}; //!< The value of the order parameter.
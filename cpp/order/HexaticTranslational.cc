@@ -1,29 +1,35 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
 #include "HexaticTranslational.h"
 
 namespace freud { namespace order {
 
 //! Compute the order parameter
 template<typename T>
-template<typename Func>
-void HexaticTranslational<T>::computeGeneral(Func func, const freud::locality::NeighborList* nlist,
+template<typename Func, typename Normalize>
+void HexaticTranslational<T>::computeGeneral(Func func, Normalize normalize,
+                                             const freud::locality::NeighborList* nlist,
                                              const freud::locality::NeighborQuery* points,
-                                             freud::locality::QueryArgs qargs, bool normalize_by_k)
+                                             freud::locality::QueryArgs qargs, unsigned int num_orders)
 {
     const auto box = points->getBox();
     box.enforce2D();
 
     const unsigned int Np = points->getNPoints();
 
-    m_psi_array.prepare(Np);
+    m_psi_array.prepare({Np, num_orders});
 
     freud::locality::loopOverNeighborsIterator(
         points, points->getPoints(), Np, qargs, nlist,
         [=](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
             float total_weight(0);
             const vec3<float> ref((*points)[i]);
+            std::complex<float>* psi = m_psi_array.get() + i * num_orders;
 
             for (freud::locality::NeighborBond nb = ppiter->next(); !ppiter->end(); nb = ppiter->next())
             {
@@ -32,31 +38,57 @@ void HexaticTranslational<T>::computeGeneral(Func func, const freud::locality::N
                 const float weight(m_weighted ? nb.weight : 1.0);
 
                 // Compute psi for this vector
-                m_psi_array[i] += weight * func(delta);
+                func(delta, weight, psi);
                 total_weight += weight;
             }
-            if (normalize_by_k)
-            {
-                m_psi_array[i] /= std::complex<float>(m_k);
-            }
-            else
+            const std::complex<float> normalization(normalize(total_weight));
+            for (unsigned int j = 0; j < num_orders; ++j)
             {
-                m_psi_array[i] /= std::complex<float>(total_weight);
+                psi[j] /= normalization;
             }
         });
 }
 
-Hexatic::Hexatic(unsigned int k, bool weighted) : HexaticTranslational<unsigned int>(k, weighted) {}
+Hexatic::Hexatic(unsigned int k, bool weighted) : Hexatic(std::vector<unsigned int> {k}, weighted) {}
+
+Hexatic::Hexatic(std::vector<unsigned int> k, bool weighted)
+    : HexaticTranslational<std::vector<unsigned int>>(std::move(k), weighted)
+{
+    if (m_k.empty())
+    {
+        throw std::invalid_argument("Hexatic requires at least one value of k.");
+    }
+}
 
 void Hexatic::compute(const freud::locality::NeighborList* nlist,
                       const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
 {
+    // Visit the symmetry orders in increasing order so that each power of z
+    // is reached from the previous one.
+    std::vector<unsigned int> order(m_k.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](unsigned int a, unsigned int b) { return m_k[a] < m_k[b]; });
+
     computeGeneral(
-        [this](const vec3<float>& delta) {
-            const float theta_ij = std::atan2(delta.y, delta.x);
-            return std::exp(std::complex<float>(0, m_k * theta_ij));
+        [this, order](const vec3<float>& delta, float weight, std::complex<float>* psi) {
+            // The unit bond vector as a complex number, e^{i theta}
+            const float r_sq = delta.x * delta.x + delta.y * delta.y;
+            const std::complex<float> z = r_sq > 0
+                ? std::complex<float>(delta.x, delta.y) / std::sqrt(r_sq)
+                : std::complex<float>(1, 0);
+
+            std::complex<float> z_power(weight, 0);
+            unsigned int power = 0;
+            for (const unsigned int j : order)
+            {
+                for (; power < m_k[j]; ++power)
+                {
+                    z_power *= z;
+                }
+                psi[j] += z_power;
+            }
         },
-        nlist, points, qargs, false);
+        [](float total_weight) { return total_weight; }, nlist, points, qargs, m_k.size());
 }
 
 Translational::Translational(float k, bool weighted) : HexaticTranslational<float>(k, weighted) {}
@@ -64,8 +96,11 @@ Translational::Translational(float k, bool weighted) : HexaticTranslational<floa
 void Translational::compute(const freud::locality::NeighborList* nlist,
                             const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
 {
-    computeGeneral([](const vec3<float>& delta) { return std::complex<float>(delta.x, delta.y); }, nlist,
-                   points, qargs, true);
+    computeGeneral(
+        [](const vec3<float>& delta, float weight, std::complex<float>* psi) {
+            psi[0] += weight * std::complex<float>(delta.x, delta.y);
+        },
+        [this](float /*total_weight*/) { return m_k; }, nlist, points, qargs, 1);
 }
 
 }; }; // namespace freud::order
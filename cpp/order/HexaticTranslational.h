@@ -5,6 +5,7 @@
 #define HEXATIC_TRANSLATIONAL_H
 
 #include <complex>
+#include <vector>
 
 #include "Box.h"
 #include "ManagedArray.h"
@@ -49,25 +50,39 @@ public:
 
 protected:
     //! Compute the order parameter
-    template<typename Func>
-    void computeGeneral(Func func, const freud::locality::NeighborList* nlist,
+    /*! \param func Functor adding the weighted contribution of a bond vector
+     *         to each of the num_orders order parameters of a point, called as
+     *         func(delta, weight, psi).
+     *  \param normalize Functor returning the normalization of the order
+     *         parameters of a point given the total weight of its bonds.
+     *  \param num_orders Number of order parameters computed for each point.
+     */
+    template<typename Func, typename Normalize>
+    void computeGeneral(Func func, Normalize normalize, const freud::locality::NeighborList* nlist,
                         const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs,
-                        bool normalize_by_k);
+                        unsigned int num_orders);
 
-    const T m_k; //!< The symmetry order for Hexatic, or normalization for Translational
+    const T m_k; //!< The symmetry orders for Hexatic, or normalization for Translational
     const bool
         m_weighted; //!< Whether to use neighbor weights in computing the order parameter (default false)
     util::ManagedArray<std::complex<float>> m_psi_array; //!< psi array computed
 };
 
 //! Compute the hexatic order parameter for a set of points
-/*!
+/*! Any number of symmetry orders k may be computed together. The unit bond
+ *  vector is treated as the complex number z = e^{i theta}, and e^{i k theta}
+ *  is obtained for all k by successive multiplication by z in a single
+ *  traversal of the neighbors. The order parameter array has shape
+ *  (N, number of k).
  */
-class Hexatic : public HexaticTranslational<unsigned int>
+class Hexatic : public HexaticTranslational<std::vector<unsigned int>>
 {
 public:
     //! Constructor
-    Hexatic(unsigned int k = 6, bool weighted = false);
+    explicit Hexatic(unsigned int k = 6, bool weighted = false);
+
+    //! Constructor for multiple symmetry orders
+    Hexatic(std::vector<unsigned int> k, bool weighted = false);
 
     //! Destructor
     ~Hexatic() override = default;
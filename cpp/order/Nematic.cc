@@ -1,10 +1,13 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <array>
 #include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
 
 #include "Nematic.h"
 #include "diagonalize.h"
+#include "utils.h"
 
 /*! \file Nematic.h
     \brief Compute the nematic order parameter for each particle
@@ -45,54 +48,50 @@ vec3<float> Nematic::getU() const
     return m_u;
 }
 
-void Nematic::compute(quat<float>* orientations, unsigned int n)
+void Nematic::compute(quat<float>* orientations, unsigned int n, bool compute_particle_tensor)
 {
     m_n = n;
-    m_particle_tensor.prepare({m_n, 3, 3});
-    m_nematic_tensor_local.reset();
 
-    // calculate per-particle tensor
-    util::forLoopWrapper(0, n, [=](size_t begin, size_t end) {
+    // Since Q_ab = 1.5 u_a u_b - 0.5 delta_ab is symmetric and linear in the
+    // outer product of the director, each thread only sums the six unique
+    // components of u u^T.
+    using OuterProductSum = std::array<double, 6>;
+    tbb::enumerable_thread_specific<OuterProductSum> thread_sums(OuterProductSum {});
+
+    util::forLoopWrapper(0, n, [=, &thread_sums](size_t begin, size_t end) {
+        OuterProductSum& local_sum = thread_sums.local();
         for (size_t i = begin; i < end; ++i)
         {
             // get the director of the particle
-            quat<float> q = orientations[i];
-            vec3<float> u_i = rotate(q, m_u);
-
-            util::ManagedArray<float> Q_ab({3, 3});
-
-            Q_ab(0, 0) = 1.5f * u_i.x * u_i.x - 0.5f;
-            Q_ab(0, 1) = 1.5f * u_i.x * u_i.y;
-            Q_ab(0, 2) = 1.5f * u_i.x * u_i.z;
-            Q_ab(1, 0) = 1.5f * u_i.y * u_i.x;
-            Q_ab(1, 1) = 1.5f * u_i.y * u_i.y - 0.5f;
-            Q_ab(1, 2) = 1.5f * u_i.y * u_i.z;
-            Q_ab(2, 0) = 1.5f * u_i.z * u_i.x;
-            Q_ab(2, 1) = 1.5f * u_i.z * u_i.y;
-            Q_ab(2, 2) = 1.5f * u_i.z * u_i.z - 0.5f;
-
-            // Set the values. The nematic tensor is reduced later.
-            for (unsigned int j = 0; j < 3; j++)
-            {
-                for (unsigned int k = 0; k < 3; k++)
-                {
-                    m_particle_tensor(i, j, k) += Q_ab(j, k);
-                    m_nematic_tensor_local.local()(j, k) += Q_ab(j, k);
-                }
-            }
+            const vec3<float> u_i = rotate(orientations[i], m_u);
+            local_sum[0] += u_i.x * u_i.x;
+            local_sum[1] += u_i.x * u_i.y;
+            local_sum[2] += u_i.x * u_i.z;
+            local_sum[3] += u_i.y * u_i.y;
+            local_sum[4] += u_i.y * u_i.z;
+            local_sum[5] += u_i.z * u_i.z;
         }
     });
 
-    // Now calculate the sum of Q_ab's
-    m_nematic_tensor.prepare({3, 3});
-    m_nematic_tensor_local.reduceInto(m_nematic_tensor);
-
-    // Normalize by the number of particles
-    for (unsigned int i = 0; i < m_nematic_tensor.size(); ++i)
+    OuterProductSum outer_sum {};
+    for (const OuterProductSum& local_sum : thread_sums)
     {
-        m_nematic_tensor[i] /= static_cast<float>(m_n);
+        for (unsigned int i = 0; i < outer_sum.size(); ++i)
+        {
+            outer_sum[i] += local_sum[i];
+        }
     }
 
+    // Normalize by the number of particles and form the average Q_ab
+    m_nematic_tensor.prepare({3, 3});
+    const double scale = 1.5 / static_cast<double>(m_n);
+    m_nematic_tensor(0, 0) = static_cast<float>(scale * outer_sum[0] - 0.5);
+    m_nematic_tensor(0, 1) = m_nematic_tensor(1, 0) = static_cast<float>(scale * outer_sum[1]);
+    m_nematic_tensor(0, 2) = m_nematic_tensor(2, 0) = static_cast<float>(scale * outer_sum[2]);
+    m_nematic_tensor(1, 1) = static_cast<float>(scale * outer_sum[3] - 0.5);
+    m_nematic_tensor(1, 2) = m_nematic_tensor(2, 1) = static_cast<float>(scale * outer_sum[4]);
+    m_nematic_tensor(2, 2) = static_cast<float>(scale * outer_sum[5] - 0.5);
+
     // the order parameter is the eigenvector belonging to the largest eigenvalue
     util::ManagedArray<float> eval = util::ManagedArray<float>(3);
     util::ManagedArray<float> evec = util::ManagedArray<float>({3, 3});
@@ -100,6 +99,35 @@ void Nematic::compute(quat<float>* orientations, unsigned int n)
     freud::util::diagonalize33SymmetricMatrix(m_nematic_tensor, eval, evec);
     m_nematic_director = vec3<float>(evec(2, 0), evec(2, 1), evec(2, 2));
     m_nematic_order_parameter = eval[2];
+
+    if (compute_particle_tensor)
+    {
+        computeParticleTensor(orientations);
+    }
+    else
+    {
+        m_particle_tensor.prepare({0, 3, 3});
+    }
+}
+
+void Nematic::computeParticleTensor(const quat<float>* orientations)
+{
+    m_particle_tensor.prepare({m_n, 3, 3});
+
+    util::forLoopWrapper(0, m_n, [=](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const vec3<float> u_i = rotate(orientations[i], m_u);
+            const std::array<float, 3> u = {u_i.x, u_i.y, u_i.z};
+            for (unsigned int j = 0; j < 3; j++)
+            {
+                for (unsigned int k = 0; k < 3; k++)
+                {
+                    m_particle_tensor(i, j, k) = 1.5f * u[j] * u[k] - (j == k ? 0.5f : 0.0f);
+                }
+            }
+        }
+    });
 }
 
 }; }; // end namespace freud::order
@@ -8,7 +8,6 @@
 
 #include "Box.h"
 #include "ManagedArray.h"
-#include "ThreadStorage.h"
 #include "VectorMath.h"
 
 /*! \file Nematic.h
@@ -29,7 +28,18 @@ public:
     virtual ~Nematic() = default;
 
     //! Compute the nematic order parameter
-    void compute(quat<float>* orientations, unsigned int n);
+    /*! \param orientations Particle orientations.
+     *  \param n Number of orientations.
+     *  \param compute_particle_tensor Whether to also compute the (N, 3, 3)
+     *         per-particle tensor. If false, it may be computed later with
+     *         computeParticleTensor.
+     */
+    void compute(quat<float>* orientations, unsigned int n, bool compute_particle_tensor = true);
+
+    //! Compute the per-particle tensor.
+    /*! Must be called after compute with the same orientations.
+     */
+    void computeParticleTensor(const quat<float>* orientations);
 
     //! Get the value of the last computed nematic order parameter
     float getNematicOrderParameter() const;
@@ -50,9 +60,8 @@ private:
     float m_nematic_order_parameter {0}; //!< Current value of the order parameter
     vec3<float> m_nematic_director;      //!< The director (eigenvector corresponding to the OP)
 
-    util::ManagedArray<float> m_nematic_tensor {{3, 3}};        //!< The computed nematic tensor.
-    util::ThreadStorage<float> m_nematic_tensor_local {{3, 3}}; //!< Thread-specific nematic tensor.
-    util::ManagedArray<float> m_particle_tensor; //!< The per-particle tensor that is summed up to Q.
+    util::ManagedArray<float> m_nematic_tensor {{3, 3}}; //!< The computed nematic tensor.
+    util::ManagedArray<float> m_particle_tensor;        //!< The per-particle tensor that is summed up to Q.
 };
 
 }; }; // end namespace freud::order
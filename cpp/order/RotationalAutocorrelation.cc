@@ -3,8 +3,12 @@
 
 #include "RotationalAutocorrelation.h"
 
+#include "FFT.h"
 #include "utils.h"
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
 
 /*! \file RotationalAutocorrelation.cc
     \brief Implements the RotationalAutocorrelation class.
@@ -12,43 +16,103 @@
 
 namespace freud { namespace order {
 
-// This function wraps exponentiation for complex numbers to avoid
-// the case where pow((0,0), 0) returns (nan, nan). Additionally, it
-// serves as a micro-optimization since std::pow can be slow. We can take the
-// exponent to be an unsigned int since all the sums in the hyperspherical
-// harmonic below guarantee this.
-inline std::complex<float> cpow(std::complex<float> base, unsigned int p)
+RotationalAutocorrelation::RotationalAutocorrelation(unsigned int l)
+    : m_l(l), m_normalization(l + 1)
 {
-    if (p == 0)
+    // For efficiency, we precompute the normalization of the harmonics for
+    // use during the per-particle computation. Factorials are computed as
+    // doubles since they exceed the range of integers for l > 12.
+    std::vector<double> factorials(m_l + 1);
+    factorials[0] = 1;
+    for (unsigned int i = 1; i <= m_l; i++)
     {
-        return {1, 0};
+        factorials[i] = i * factorials[i - 1];
     }
-    std::complex<float> val(base);
-    for (unsigned int i = 1; i < p; i++)
+    for (unsigned int i = 0; i <= m_l; i++)
     {
-        val *= base;
+        m_normalization[i] = std::sqrt(factorials[i] * factorials[m_l - i]);
     }
-    return val;
 }
 
-inline std::complex<float> RotationalAutocorrelation::hypersphere_harmonic(const std::complex<float> xi,
-                                                                           std::complex<float> zeta,
-                                                                           const unsigned int m1,
-                                                                           const unsigned int m2)
+void RotationalAutocorrelation::computePowers(const quat<float>& q, HarmonicPowers& powers) const
 {
-    const std::complex<float> xi_conj = std::conj(xi);
-    const std::complex<float> zeta_conj = std::conj(zeta);
+    // Transform the orientation quaternion into Xi/Zeta coordinates.
+    const std::complex<double> xi(q.v.x, q.v.y);
+    const std::complex<double> zeta(q.v.z, q.s);
 
+    powers.xi_conj[0] = powers.zeta[0] = powers.zeta_conj[0] = powers.neg_xi[0] = 1;
+    for (unsigned int k = 1; k <= m_l; k++)
+    {
+        const double inv_k = 1.0 / k;
+        powers.xi_conj[k] = powers.xi_conj[k - 1] * std::conj(xi) * inv_k;
+        powers.zeta[k] = powers.zeta[k - 1] * zeta * inv_k;
+        powers.zeta_conj[k] = powers.zeta_conj[k - 1] * std::conj(zeta) * inv_k;
+        powers.neg_xi[k] = powers.neg_xi[k - 1] * (-xi) * inv_k;
+    }
+}
+
+std::complex<double> RotationalAutocorrelation::hypersphere_harmonic(const HarmonicPowers& powers,
+                                                                     unsigned int m1, unsigned int m2) const
+{
     // Doing a summation over non-negative exponents, which requires the additional inner conditional.
-    std::complex<float> sum_tracker(0, 0);
+    std::complex<double> sum_tracker(0, 0);
     for (unsigned int k = (m1 + m2 < m_l ? 0 : m1 + m2 - m_l); k <= std::min(m1, m2); k++)
     {
-        float fact_product = static_cast<float>(m_factorials[k]) * m_factorials[m_l + k - m1 - m2]
-            * m_factorials[m1 - k] * m_factorials[m2 - k];
-        sum_tracker += cpow(xi_conj, k) * cpow(zeta, m2 - k) * cpow(zeta_conj, m1 - k)
-            * cpow(-xi, m_l + k - m1 - m2) / fact_product;
+        sum_tracker += powers.xi_conj[k] * powers.zeta[m2 - k] * powers.zeta_conj[m1 - k]
+            * powers.neg_xi[m_l + k - m1 - m2];
+    }
+    return sum_tracker * (m_normalization[m1] * m_normalization[m2]);
+}
+
+void RotationalAutocorrelation::firstHarmonicColumn(const HarmonicPowers& powers,
+                                                    std::complex<double>* column) const
+{
+    for (unsigned int a = 0; a <= m_l; a++)
+    {
+        column[a] = powers.zeta_conj[a] * powers.neg_xi[m_l - a];
+    }
+}
+
+void RotationalAutocorrelation::nextHarmonicColumn(const quat<float>& q, unsigned int b,
+                                                   std::complex<double>* column) const
+{
+    const std::complex<double> xi(q.v.x, q.v.y);
+    const std::complex<double> zeta(q.v.z, q.s);
+    const std::complex<double> xi_conj = std::conj(xi);
+    const std::complex<double> zeta_conj = std::conj(zeta);
+
+    // Of the two recurrences for the next column, use the one dividing by
+    // the larger of |zeta| and |xi|, which is at least 1/sqrt(2) for a
+    // unit quaternion. Each is ordered so that the entries it reads have
+    // not been overwritten yet.
+    if (std::abs(zeta) >= std::abs(xi))
+    {
+        // conj(zeta) (b + 1) f(a, b + 1) = conj(xi) (a - b) f(a, b) + zeta (a + 1) f(a + 1, b)
+        const std::complex<double> inv_divisor = 1.0 / (zeta_conj * double(b + 1));
+        for (unsigned int a = 0; a <= m_l; a++)
+        {
+            std::complex<double> next = xi_conj * (double(a) - double(b)) * column[a];
+            if (a < m_l)
+            {
+                next += zeta * double(a + 1) * column[a + 1];
+            }
+            column[a] = next * inv_divisor;
+        }
+    }
+    else
+    {
+        // -xi (b + 1) f(a, b + 1) = conj(xi) (l - a + 1) f(a - 1, b) + zeta (l - a - b) f(a, b)
+        const std::complex<double> inv_divisor = 1.0 / (-xi * double(b + 1));
+        for (unsigned int a = m_l + 1; a-- > 0;)
+        {
+            std::complex<double> next = zeta * (double(m_l) - double(a) - double(b)) * column[a];
+            if (a > 0)
+            {
+                next += xi_conj * double(m_l - a + 1) * column[a - 1];
+            }
+            column[a] = next * inv_divisor;
+        }
     }
-    return sum_tracker;
 }
 
 void RotationalAutocorrelation::compute(const quat<float>* ref_orientations, const quat<float>* orientations,
@@ -57,46 +121,30 @@ void RotationalAutocorrelation::compute(const quat<float>* ref_orientations, con
     m_RA_array.prepare(N);
 
     // Precompute the hyperspherical harmonics for the unit quaternion. The
-    // default quaternion constructor gives a unit quaternion. We will assume
-    // the same iteration order here as in the loop below to save ourselves
-    // from having to use a more expensive process (i.e. a map).
-    std::complex<float> xi = std::complex<float>(0, 0);
-    std::complex<float> zeta = std::complex<float>(0, 1);
-    std::vector<std::complex<float>> unit_harmonics;
-    std::vector<std::vector<float>> prefactors(m_l + 1, std::vector<float>(m_l + 1, float(0)));
+    // default quaternion constructor gives a unit quaternion, for which
+    // xi = 0. All harmonics then vanish except those with m1 + m2 = l, so
+    // only those terms contribute to the inner product below.
+    HarmonicPowers unit_powers(m_l);
+    computePowers(quat<float>(), unit_powers);
+    std::vector<std::complex<double>> unit_harmonics(m_l + 1);
     for (unsigned int a = 0; a <= m_l; a++)
     {
-        for (unsigned int b = 0; b <= m_l; b++)
-        {
-            unit_harmonics.push_back(std::conj(hypersphere_harmonic(xi, zeta, a, b)));
-            prefactors[a][b] = static_cast<float>(m_factorials[a] * m_factorials[m_l - a] * m_factorials[b]
-                                                  * m_factorials[m_l - b])
-                / (static_cast<float>(m_l + 1));
-        }
+        unit_harmonics[a] = std::conj(hypersphere_harmonic(unit_powers, a, m_l - a)) / double(m_l + 1);
     }
 
     // Parallel loop is over orientations (technically (ref_or, or) pairs).
-    util::forLoopWrapper(0, N, [=](size_t begin, size_t end) {
+    util::forLoopWrapper(0, N, [=, &unit_harmonics](size_t begin, size_t end) {
+        HarmonicPowers powers(m_l);
         for (size_t i = begin; i < end; ++i)
         {
-            // Transform the orientation quaternions into Xi/Zeta coordinates;
-            quat<float> qq_1 = conj(ref_orientations[i]) * orientations[i];
-            std::complex<float> xi = std::complex<float>(qq_1.v.x, qq_1.v.y);
-            std::complex<float> zeta = std::complex<float>(qq_1.v.z, qq_1.s);
-
-            // Loop through the valid quantum numbers.
-            m_RA_array[i] = std::complex<float>(0, 0);
-            unsigned int uh_index = 0;
+            computePowers(conj(ref_orientations[i]) * orientations[i], powers);
+
+            std::complex<double> RA_value(0, 0);
             for (unsigned int a = 0; a <= m_l; a++)
             {
-                for (unsigned int b = 0; b <= m_l; b++)
-                {
-                    std::complex<float> combined_value
-                        = unit_harmonics[uh_index] * hypersphere_harmonic(xi, zeta, a, b);
-                    m_RA_array[i] += prefactors[a][b] * combined_value;
-                    uh_index += 1;
-                }
+                RA_value += unit_harmonics[a] * hypersphere_harmonic(powers, a, m_l - a);
             }
+            m_RA_array[i] = std::complex<float>(RA_value);
         }
     });
 
@@ -106,6 +154,98 @@ void RotationalAutocorrelation::compute(const quat<float>* ref_orientations, con
         RA_sum += std::real(m_RA_array[i]);
     }
     m_Ft = RA_sum / static_cast<float>(N);
-};
+}
+
+void RotationalAutocorrelation::computeTrajectory(const quat<float>* orientations, unsigned int n_frames,
+                                                  unsigned int N)
+{
+    if (n_frames == 0 || N == 0)
+    {
+        throw std::invalid_argument("RotationalAutocorrelation requires at least one frame and particle.");
+    }
+
+    const unsigned int width = m_l + 1;
+    // Zero padding to twice the number of frames avoids wrapping around in
+    // the circular correlation computed by the FFT.
+    const size_t fft_size = util::nextPowerOfTwo(2 * static_cast<size_t>(n_frames));
+
+    // Each thread sums the power spectra of all harmonic time series of its
+    // particles, since the sum of their correlations is needed.
+    tbb::enumerable_thread_specific<std::vector<double>> thread_spectra(std::vector<double>(fft_size, 0));
+
+    util::forLoopWrapper(0, N, [=, &thread_spectra](size_t begin, size_t end) {
+        std::vector<double>& spectrum = thread_spectra.local();
+        HarmonicPowers powers(m_l);
+        // Only one column m2 of unnormalized harmonics is kept for every
+        // frame, indexed as [frame * (l + 1) + m1], and one harmonic is
+        // transformed at a time, so memory does not grow with (l + 1)^2.
+        std::vector<std::complex<double>> columns(static_cast<size_t>(n_frames) * width);
+        std::vector<std::complex<double>> series(fft_size);
+        for (size_t i = begin; i < end; ++i)
+        {
+            for (unsigned int t = 0; t < n_frames; t++)
+            {
+                computePowers(orientations[t * N + i], powers);
+                firstHarmonicColumn(powers, &columns[static_cast<size_t>(t) * width]);
+            }
+
+            for (unsigned int b = 0; b <= m_l / 2; b++)
+            {
+                if (b > 0)
+                {
+                    for (unsigned int t = 0; t < n_frames; t++)
+                    {
+                        nextHarmonicColumn(orientations[t * N + i], b - 1,
+                                           &columns[static_cast<size_t>(t) * width]);
+                    }
+                }
+
+                // Column l - b holds the harmonics of column b conjugated up
+                // to sign, whose power spectra are those of column b at
+                // negated frequencies, so columns m2 > l / 2 need no
+                // transforms of their own.
+                const bool has_mirror = m_l - b > m_l / 2;
+                for (unsigned int a = 0; a <= m_l; a++)
+                {
+                    const double normalization = m_normalization[a] * m_normalization[b];
+                    for (unsigned int t = 0; t < n_frames; t++)
+                    {
+                        series[t] = columns[static_cast<size_t>(t) * width + a] * normalization;
+                    }
+                    std::fill(series.begin() + n_frames, series.end(), std::complex<double>(0, 0));
+                    util::fft(series.data(), fft_size);
+                    for (size_t k = 0; k < fft_size; k++)
+                    {
+                        spectrum[k] += std::norm(series[k]);
+                        if (has_mirror)
+                        {
+                            spectrum[k] += std::norm(series[(fft_size - k) % fft_size]);
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    // By the Wiener-Khinchin theorem, the inverse transform of the summed
+    // power spectra is the sum over particles and time origins of
+    // conj(Y(t)) * Y(t + lag).
+    std::vector<std::complex<double>> correlation(fft_size);
+    for (const std::vector<double>& spectrum : thread_spectra)
+    {
+        for (size_t k = 0; k < fft_size; k++)
+        {
+            correlation[k] += spectrum[k];
+        }
+    }
+    util::fft(correlation.data(), fft_size, true);
+
+    m_lag_Ft.prepare(n_frames);
+    for (unsigned int lag = 0; lag < n_frames; lag++)
+    {
+        const double num_pairs = static_cast<double>(N) * (n_frames - lag);
+        m_lag_Ft[lag] = static_cast<float>(correlation[lag].real() / (num_pairs * width));
+    }
+}
 
 }; }; // end namespace freud::order
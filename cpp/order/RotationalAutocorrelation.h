@@ -5,6 +5,7 @@
 #define ROTATIONAL_AUTOCORRELATION_H
 
 #include <complex>
+#include <vector>
 
 #include "ManagedArray.h"
 #include "VectorMath.h"
@@ -50,17 +51,7 @@ public:
     //! Constructor
     /*! \param l The order of the spherical harmonic.
      */
-    explicit RotationalAutocorrelation(unsigned int l) : m_l(l)
-    {
-        // For efficiency, we precompute all required factorials for use during
-        // the per-particle computation.
-        m_factorials.prepare(m_l + 1);
-        m_factorials[0] = 1;
-        for (unsigned int i = 1; i <= m_l; i++)
-        {
-            m_factorials[i] = i * m_factorials[i - 1];
-        }
-    }
+    explicit RotationalAutocorrelation(unsigned int l);
 
     //! Destructor
     ~RotationalAutocorrelation() = default;
@@ -83,6 +74,12 @@ public:
         return m_Ft;
     }
 
+    //! Get a reference to the last computed autocorrelation for each lag time.
+    const util::ManagedArray<float>& getLagAutocorrelation() const
+    {
+        return m_lag_Ft;
+    }
+
     //! Compute the rotational autocorrelation.
     /*! \param ref_orientations Quaternions in initial frame.
      *  \param orientations Quaternions in current frame.
@@ -98,30 +95,90 @@ public:
      */
     void compute(const quat<float>* ref_orientations, const quat<float>* orientations, unsigned int N);
 
+    //! Compute the rotational autocorrelation of a trajectory for all lag times.
+    /*! \param orientations Quaternions for each frame, indexed as [frame * N + particle].
+     *  \param n_frames The number of frames.
+     *  \param N The number of orientations in each frame.
+     *
+     *  The inner product of the hyperspherical harmonics of two orientations
+     *  is a sum over all (m1, m2) of products of the individual harmonics.
+     *  The autocorrelation for a lag of t frames, averaged over all time
+     *  origins, is therefore a sum of time correlations of the harmonic
+     *  coefficients of each particle, which are computed with fast Fourier
+     *  transforms. The result for each lag is the value that compute would
+     *  give for frames separated by that lag, averaged over all such pairs
+     *  of frames.
+     */
+    void computeTrajectory(const quat<float>* orientations, unsigned int n_frames, unsigned int N);
+
 private:
-    //! Compute a hyperspherical harmonic.
-    /*! \param xi The first complex number coordinate.
-     *  \param zeta The second complex number coordinate.
-     *  \param l The azimuthal quantum number.
+    //! Powers of the complex coordinates of a quaternion divided by factorials.
+    struct HarmonicPowers
+    {
+        explicit HarmonicPowers(unsigned int l) : xi_conj(l + 1), zeta(l + 1), zeta_conj(l + 1), neg_xi(l + 1)
+        {}
+
+        std::vector<std::complex<double>> xi_conj;   //!< conj(xi)^k / k!
+        std::vector<std::complex<double>> zeta;      //!< zeta^k / k!
+        std::vector<std::complex<double>> zeta_conj; //!< conj(zeta)^k / k!
+        std::vector<std::complex<double>> neg_xi;    //!< (-xi)^k / k!
+    };
+
+    //! Tabulate the powers of the complex coordinates of a quaternion.
+    /*! Each power is obtained from the previous one by a single
+     *  multiplication, so tabulating all powers up to l costs O(l).
+     */
+    void computePowers(const quat<float>& q, HarmonicPowers& powers) const;
+
+    //! Compute a normalized hyperspherical harmonic.
+    /*! \param powers Tabulated powers of the complex coordinates.
      *  \param m1 The first magnetic quantum number.
      *  \param m2 The second magnetic quantum number.
-     *  \return The value of the hyperspherical harmonic (l, m1, m2) at (xi, zeta).
+     *  \return The value of the hyperspherical harmonic (l, m1, m2).
      *
      *  The hyperspherical harmonic function is a generalization of spherical
      *  harmonics from the 2-sphere to the 3-sphere. For details, see Harmonic
      *  functions and matrix elements for hyperspherical quantum field models
-     *  (https://doi.org/10.1063/1.526210). The function needs to be a class
-     *  method to access the cached factorial values for the class's value of
-     *  m_l.
+     *  (https://doi.org/10.1063/1.526210). The harmonics are normalized such
+     *  that the (l + 1) x (l + 1) matrix of all (m1, m2) is unitary, which
+     *  makes the autocorrelation the average of the inner products of these
+     *  matrices divided by l + 1. Evaluating a single harmonic costs
+     *  O(min(m1, m2)) from the tabulated powers.
+     */
+    std::complex<double> hypersphere_harmonic(const HarmonicPowers& powers, unsigned int m1,
+                                              unsigned int m2) const;
+
+    //! Compute the column m2 = 0 of the unnormalized hyperspherical harmonics.
+    /*! \param powers Tabulated powers of the complex coordinates.
+     *  \param column Output of size l + 1, indexed by m1.
+     *
+     *  The unnormalized harmonics f(m1, m2) are the coefficients of
+     *  s^m1 t^m2 in (conj(zeta) s - xi + t (conj(xi) s + zeta))^l / l!, so
+     *  the column m2 = 0 is a single product of tabulated powers. Multiplying
+     *  f(m1, m2) by sqrt(m1! (l - m1)! m2! (l - m2)!) gives the harmonic
+     *  computed by hypersphere_harmonic.
+     */
+    void firstHarmonicColumn(const HarmonicPowers& powers, std::complex<double>* column) const;
+
+    //! Advance a column of unnormalized hyperspherical harmonics from m2 = b to m2 = b + 1.
+    /*! \param q The orientation the harmonics are evaluated at.
+     *  \param b The current value of m2.
+     *  \param column The column f(m1, b), overwritten in place by f(m1, b + 1).
+     *
+     *  The partial derivatives of the generating function give a two term
+     *  recurrence in O(l) per column. Columns with m2 > l / 2 follow from the
+     *  symmetry Y(l - m1, l - m2) = (-1)^(l + m1 + m2) conj(Y(m1, m2)), so all
+     *  harmonics of an orientation cost O(l^2) instead of O(l^3) for
+     *  evaluating each harmonic.
      */
-    std::complex<float> hypersphere_harmonic(const std::complex<float> xi, std::complex<float> zeta,
-                                             const unsigned int m1, const unsigned int m2);
+    void nextHarmonicColumn(const quat<float>& q, unsigned int b, std::complex<double>* column) const;
 
     unsigned int m_l; //!< Order of the hyperspherical harmonic.
     float m_Ft {0};   //!< Real value of calculated RA function.
 
     util::ManagedArray<std::complex<float>> m_RA_array; //!< Array of RA values per particle
-    util::ManagedArray<unsigned int> m_factorials;      //!< Array of cached factorials
+    util::ManagedArray<float> m_lag_Ft;                 //!< RA function for each lag time
+    std::vector<double> m_normalization;                //!< Cached values of sqrt(m! (l - m)!)
 };
 
 }; }; // end namespace freud::order
@@ -1,6 +1,7 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
 #include <stdexcept>
 
 #include "NeighborComputeFunctional.h"
@@ -8,6 +9,26 @@
 
 namespace freud { namespace order {
 
+namespace {
+
+//! Make a filter accepting solid-like bonds between two solid-like particles.
+/*! A bond is solid-like if its ql_ij exceeds q_threshold, and a particle is
+ *  solid-like if it has at least solid_threshold solid-like bonds.
+ */
+auto makeSolidBondFilter(const locality::NeighborList& nlist, const util::ManagedArray<float>& ql_ij,
+                         float q_threshold, unsigned int solid_threshold,
+                         const util::ManagedArray<unsigned int>& number_of_connections)
+{
+    return [&nlist, &ql_ij, &number_of_connections, q_threshold, solid_threshold](size_t bond) {
+        const unsigned int i(nlist.getNeighbors()(bond, 0));
+        const unsigned int j(nlist.getNeighbors()(bond, 1));
+        return ql_ij[bond] > q_threshold && number_of_connections[i] >= solid_threshold
+            && number_of_connections[j] >= solid_threshold;
+    };
+}
+
+}; // end anonymous namespace
+
 SolidLiquid::SolidLiquid(unsigned int l, float q_threshold, unsigned int solid_threshold, bool normalize_q)
     : m_l(l), m_num_ms(2 * l + 1), m_q_threshold(q_threshold), m_solid_threshold(solid_threshold),
       m_normalize_q(normalize_q), m_steinhardt(l), m_cluster()
@@ -29,19 +50,23 @@ void SolidLiquid::compute(const freud::locality::NeighborList* nlist,
 
     // Compute Steinhardt using neighbor list (also gets ql for normalization)
     m_steinhardt.compute(&m_nlist, points, qargs);
-    const auto& qlm = m_steinhardt.getQlm();
+    // The Steinhardt instance computes a single l, so its outputs have one entry per particle.
+    const auto& qlm = m_steinhardt.getQlm()[0];
     const auto& ql = m_steinhardt.getQl();
 
-    // Compute (normalized) dot products for each bond in the neighbor list
+    // Compute (normalized) dot products for each bond in the neighbor list,
+    // counting the solid-like bonds of each query point in the same pass.
     const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
     const unsigned int num_bonds(m_nlist.getNumBonds());
     m_ql_ij.prepare(num_bonds);
+    m_number_of_connections.prepare(num_query_points);
 
     util::forLoopWrapper(
         0, num_query_points,
         [=](size_t begin, size_t end) {
             for (unsigned int i = begin; i != end; ++i)
             {
+                unsigned int num_connections(0);
                 unsigned int bond(m_nlist.find_first_index(i));
                 for (; bond < num_bonds && m_nlist.getNeighbors()(bond, 0) == i; ++bond)
                 {
@@ -61,43 +86,70 @@ void SolidLiquid::compute(const freud::locality::NeighborList* nlist,
                         bond_ql_ij *= normalizationfactor / (ql[i] * ql[j]);
                     }
                     m_ql_ij[bond] = bond_ql_ij.real();
+                    if (m_ql_ij[bond] > m_q_threshold)
+                    {
+                        ++num_connections;
+                    }
                 }
+                m_number_of_connections[i] = num_connections;
             }
         },
         true);
 
-    // Filter neighbors to contain only solid-like bonds
-    std::vector<bool> solid_filter(num_bonds);
-    for (unsigned int bond(0); bond < num_bonds; bond++)
-    {
-        solid_filter[bond] = (m_ql_ij[bond] > m_q_threshold);
-    }
-    freud::locality::NeighborList solid_nlist(m_nlist);
-    solid_nlist.filter(solid_filter.cbegin());
+    // Find clusters of solid-like particles (particles with at least
+    // solid_threshold solid-like bonds) connected by solid-like bonds.
+    m_cluster.computeFiltered(points->getNPoints(), &m_nlist,
+                              makeSolidBondFilter(m_nlist, m_ql_ij, m_q_threshold, m_solid_threshold,
+                                                  m_number_of_connections));
+}
 
-    // Save the neighbor counts of solid-like bonds for each query point
-    m_number_of_connections.prepare(num_query_points);
-    for (unsigned int i(0); i < num_query_points; i++)
+std::vector<unsigned int>
+SolidLiquid::sweepThresholds(const std::vector<float>& q_thresholds,
+                             const std::vector<unsigned int>& solid_thresholds) const
+{
+    if (q_thresholds.size() != solid_thresholds.size())
     {
-        m_number_of_connections[i] = solid_nlist.getCounts()[i];
+        throw std::invalid_argument(
+            "SolidLiquid requires the same number of q_thresholds and solid_thresholds.");
     }
 
-    // Filter nlist to only bonds between solid-like particles
-    // (particles with more than solid_threshold solid-like bonds)
-    const unsigned int num_solid_bonds(solid_nlist.getNumBonds());
-    std::vector<bool> neighbor_count_filter(num_solid_bonds);
-    for (unsigned int bond(0); bond < num_solid_bonds; bond++)
+    const unsigned int num_query_points(m_nlist.getNumQueryPoints());
+    const unsigned int num_points(m_nlist.getNumPoints());
+    const auto& segments = m_nlist.getSegments();
+    const auto& counts = m_nlist.getCounts();
+
+    std::vector<unsigned int> largest_cluster_sizes;
+    largest_cluster_sizes.reserve(q_thresholds.size());
+    util::ManagedArray<unsigned int> number_of_connections(num_query_points);
+    for (size_t sweep_index = 0; sweep_index < q_thresholds.size(); ++sweep_index)
     {
-        const unsigned int i(solid_nlist.getNeighbors()(bond, 0));
-        const unsigned int j(solid_nlist.getNeighbors()(bond, 1));
-        neighbor_count_filter[bond] = (m_number_of_connections[i] >= m_solid_threshold
-                                       && m_number_of_connections[j] >= m_solid_threshold);
+        const float q_threshold(q_thresholds[sweep_index]);
+        if (q_threshold < 0.0)
+        {
+            throw std::invalid_argument(
+                "SolidLiquid requires that the dot product cutoff q_threshold must be non-negative.");
+        }
+
+        // Count the solid-like bonds of each query point from the stored ql_ij.
+        util::forLoopWrapper(0, num_query_points, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i)
+            {
+                const float* first_ql_ij(m_ql_ij.get() + segments[i]);
+                number_of_connections[i] = std::count_if(
+                    first_ql_ij, first_ql_ij + counts[i],
+                    [q_threshold](float ql_ij) { return ql_ij > q_threshold; });
+            }
+        });
+
+        cluster::Cluster cluster;
+        cluster.computeFiltered(num_points, &m_nlist,
+                                makeSolidBondFilter(m_nlist, m_ql_ij, q_threshold,
+                                                    solid_thresholds[sweep_index], number_of_connections));
+        const unsigned int largest_cluster_size(
+            cluster.getNumClusters() > 0 ? cluster.getClusterSize(0) : 0);
+        largest_cluster_sizes.push_back(largest_cluster_size);
     }
-    freud::locality::NeighborList solid_neighbor_nlist(solid_nlist);
-    solid_neighbor_nlist.filter(neighbor_count_filter.cbegin());
-
-    // Find clusters of solid-like particles
-    m_cluster.compute(points, &solid_neighbor_nlist, qargs);
+    return largest_cluster_sizes;
 }
 
 }; }; // end namespace freud::order
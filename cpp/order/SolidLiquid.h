@@ -5,7 +5,6 @@
 #define SOLID_LIQUID_H
 
 #include <complex>
-#include <iterator>
 #include <vector>
 
 #include "Cluster.h"
@@ -36,6 +35,10 @@ namespace freud { namespace order {
  *  the particle is considered solid-like. Finally, solid-like particles are
  *  clustered.
  *
+ *  The bond parameters and solid-like bond counts are computed in a single
+ *  pass over the NeighborList, and the surviving bonds are merged directly
+ *  into the clusters without building filtered NeighborLists.
+ *
  *  References:
  *  ten Wolde, P. R., Ruiz-Montero, M. J., & Frenkel, D. (1995).
  *  Numerical Evidence for bcc Ordering at the Surface of a Critical fcc Nucleus.
@@ -88,20 +91,31 @@ public:
     void compute(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
                  freud::locality::QueryArgs qargs);
 
+    //! Find the largest solid-like cluster for several pairs of thresholds.
+    /*! The ql_ij values from the last call to compute are reused, so only
+     *  the bond filtering and clustering are repeated for each pair.
+     *
+     *  \param q_thresholds Dot product cutoff for each pair.
+     *  \param solid_thresholds Solid-like bond count cutoff for each pair.
+     *  \return Largest cluster size for each pair.
+     */
+    std::vector<unsigned int> sweepThresholds(const std::vector<float>& q_thresholds,
+                                              const std::vector<unsigned int>& solid_thresholds) const;
+
     //! Returns largest cluster size.
     unsigned int getLargestClusterSize() const
     {
-        return m_cluster.getClusterKeys()[0].size();
+        return m_cluster.getClusterSize(0);
     }
 
     //! Returns a vector containing the size of all clusters.
     std::vector<unsigned int> getClusterSizes() const
     {
-        auto keys = m_cluster.getClusterKeys();
-        std::vector<unsigned int> sizes;
-        sizes.reserve(keys.size());
-        std::transform(keys.begin(), keys.end(), std::back_inserter(sizes),
-                       [](auto& key) { return key.size(); });
+        std::vector<unsigned int> sizes(m_cluster.getNumClusters());
+        for (unsigned int i = 0; i < sizes.size(); ++i)
+        {
+            sizes[i] = m_cluster.getClusterSize(i);
+        }
         return sizes;
     }
 
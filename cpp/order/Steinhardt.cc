@@ -1,6 +1,12 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <tbb/enumerable_thread_specific.h>
+#include <utility>
+
 #include "Steinhardt.h"
 #include "NeighborComputeFunctional.h"
 #include "utils.h"
@@ -11,49 +17,48 @@
 
 namespace freud { namespace order {
 
-// Calculating Ylm using fsph module
-void Steinhardt::computeYlm(const float theta, const float phi, std::vector<std::complex<float>>& Ylm) const
+Steinhardt::Steinhardt(std::vector<unsigned int> l, bool average, bool wl, bool weighted,
+                       bool wl_normalize)
+    : m_l(std::move(l)), m_average(average), m_wl(wl), m_weighted(weighted), m_wl_normalize(wl_normalize)
 {
-    if (Ylm.size() != m_num_ms)
+    if (m_l.empty())
     {
-        Ylm.resize(m_num_ms);
+        throw std::invalid_argument("Steinhardt requires at least one value of l.");
     }
-
-    fsph::PointSPHEvaluator<float> sph_eval(m_l);
-
-    unsigned int m_index(0);
-    sph_eval.compute(theta, phi);
-
-    for (typename fsph::PointSPHEvaluator<float>::iterator iter(sph_eval.begin_l(m_l, 0, true));
-         iter != sph_eval.end(); ++iter)
+    m_l_max = *std::max_element(m_l.begin(), m_l.end());
+    for (const unsigned int l_value : m_l)
     {
-        // Manually add the Condon-Shortley phase, (-1)^m, to positive odd m
-        float phase = 1;
-        if (m_index <= m_l && m_index % 2 == 1)
-        {
-            phase = -1;
-        }
-
-        Ylm[m_index] = phase * (*iter);
-        ++m_index;
+        m_num_ms.push_back(2 * l_value + 1);
+        m_qlm_local.emplace_back(2 * l_value + 1);
     }
 }
 
 void Steinhardt::reallocateArrays(unsigned int Np)
 {
     m_Np = Np;
-    m_qlmi.prepare({Np, m_num_ms});
-    m_qlm.prepare(m_num_ms);
-    m_qli.prepare(Np);
+    const size_t num_l(m_l.size());
+    m_qlmi.resize(num_l);
+    m_qlm.resize(num_l);
+    for (size_t l_index = 0; l_index < num_l; ++l_index)
+    {
+        m_qlmi[l_index].prepare({Np, m_num_ms[l_index]});
+        m_qlm[l_index].prepare(m_num_ms[l_index]);
+    }
+    m_qli.prepare({Np, num_l});
     if (m_average)
     {
-        m_qlmiAve.prepare({Np, m_num_ms});
-        m_qliAve.prepare(Np);
+        m_qlmiAve.resize(num_l);
+        for (size_t l_index = 0; l_index < num_l; ++l_index)
+        {
+            m_qlmiAve[l_index].prepare({Np, m_num_ms[l_index]});
+        }
+        m_qliAve.prepare({Np, num_l});
     }
     if (m_wl)
     {
-        m_wli.prepare(Np);
+        m_wli.prepare({Np, num_l});
     }
+    m_norm.prepare(num_l);
 }
 
 void Steinhardt::compute(const freud::locality::NeighborList* nlist,
@@ -62,16 +67,28 @@ void Steinhardt::compute(const freud::locality::NeighborList* nlist,
     // Allocate and zero out arrays as necessary.
     reallocateArrays(points->getNPoints());
 
+    // The average needs the first shell as a NeighborList, so if none is
+    // provided, the neighbors are queried once and used for both shells.
+    std::unique_ptr<locality::NeighborList> queried_nlist;
+    if (m_average && nlist == nullptr)
+    {
+        queried_nlist.reset(points->query(points->getPoints(), m_Np, qargs)->toNeighborList());
+        nlist = queried_nlist.get();
+    }
+
     // Computes the base qlmi required for each specialized order parameter
     baseCompute(nlist, points, qargs);
 
     if (m_average)
     {
-        computeAve(nlist, points, qargs);
+        computeAve(*nlist);
     }
 
     // Reduce qlm
-    m_qlm_local.reduceInto(m_qlm);
+    for (size_t l_index = 0; l_index < m_l.size(); ++l_index)
+    {
+        m_qlm_local[l_index].reduceInto(m_qlm[l_index]);
+    }
 
     if (m_wl)
     {
@@ -84,180 +101,243 @@ void Steinhardt::compute(const freud::locality::NeighborList* nlist,
             aggregatewl(m_wli, m_qlmi, m_qli);
         }
     }
-    m_norm = normalizeSystem();
+    normalizeSystem();
 }
 
 void Steinhardt::baseCompute(const freud::locality::NeighborList* nlist,
                              const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
 {
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
+    const size_t num_l(m_l.size());
     // For consistency, this reset is done here regardless of whether the array
     // is populated in baseCompute or computeAve.
-    m_qlm_local.reset();
+    for (auto& qlm_local : m_qlm_local)
+    {
+        qlm_local.reset();
+    }
+    // Each thread evaluates its bonds' harmonics in batches, up to m_l_max
+    // once for all l.
+    tbb::enumerable_thread_specific<util::SphericalHarmonics> local_sph((util::SphericalHarmonics(m_l_max)));
     freud::locality::loopOverNeighborsIterator(
         points, points->getPoints(), m_Np, qargs, nlist,
-        [=](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
+        [=, &local_sph](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
+            util::SphericalHarmonics& sph(local_sph.local());
+            constexpr unsigned int batch_size(util::SphericalHarmonics::batch_size);
+            vec3<float> deltas[batch_size];
+            float weights[batch_size];
+            unsigned int num_batch(0);
+
             float total_weight(0);
             const vec3<float> ref((*points)[i]);
             for (freud::locality::NeighborBond nb = ppiter->next(); !ppiter->end(); nb = ppiter->next())
             {
-                const vec3<float> delta = points->getBox().wrap((*points)[nb.point_idx] - ref);
-                const float weight(m_weighted ? nb.weight : float(1.0));
-
-                // phi is usually in range 0..2Pi, but
-                // it only appears in Ylm as exp(im\phi),
-                // so range -Pi..Pi will give same results.
-                float phi = std::atan2(delta.y, delta.x); // -Pi..Pi
-
-                // This value must be clamped in cases where the particles are
-                // aligned along z, otherwise due to floating point error we
-                // could get delta.z/nb.distance = -1-eps, which is outside the
-                // valid range of std::acos.
-                float theta = std::acos(util::clamp(delta.z / nb.distance, -1, 1)); // 0..Pi
-
-                // If the points are directly on top of each other,
-                // theta should be zero instead of nan.
-                if (nb.distance == float(0))
+                deltas[num_batch] = points->getBox().wrap((*points)[nb.point_idx] - ref);
+                weights[num_batch] = m_weighted ? nb.weight : float(1.0);
+                total_weight += weights[num_batch];
+                if (++num_batch == batch_size)
                 {
-                    theta = 0;
+                    sph.compute(deltas, num_batch);
+                    sph.accumulate(weights, num_batch);
+                    num_batch = 0;
                 }
+            } // End loop going over neighbor bonds
+            if (num_batch > 0)
+            {
+                sph.compute(deltas, num_batch);
+                sph.accumulate(weights, num_batch);
+            }
 
-                std::vector<std::complex<float>> Ylm(m_num_ms);
-                computeYlm(theta, phi, Ylm); // Fill up Ylm
-
-                for (unsigned int k = 0; k < m_num_ms; ++k)
+            // Expand the summed m >= 0 harmonics to m = -l..l, adding the
+            // Condon-Shortley phase, (-1)^m, to positive odd m.
+            const std::vector<std::complex<float>>& Ylm_sums(sph.reduce());
+            for (size_t l_index = 0; l_index < num_l; ++l_index)
+            {
+                const unsigned int l(m_l[l_index]);
+                auto& qlmi = m_qlmi[l_index];
+                const size_t row = qlmi.getIndex({i, 0});
+                for (unsigned int m = 0; m <= l; ++m)
                 {
-                    m_qlmi({static_cast<unsigned int>(i), k}) += weight * Ylm[k];
+                    const std::complex<float> Ylm_sum(Ylm_sums[util::SphericalHarmonics::index(l, m)]);
+                    qlmi[row + m] = (m % 2 == 1) ? -Ylm_sum : Ylm_sum;
+                    if (m > 0)
+                    {
+                        qlmi[row + l + m] = std::conj(Ylm_sum);
+                    }
                 }
-                total_weight += weight;
-            } // End loop going over neighbor bonds
+            }
 
             // Normalize!
-            for (unsigned int k = 0; k < m_num_ms; ++k)
+            for (size_t l_index = 0; l_index < num_l; ++l_index)
             {
-                // Cache the index for efficiency.
-                const unsigned int index = m_qlmi.getIndex({static_cast<unsigned int>(i), k});
-                m_qlmi[index] /= total_weight;
-                // Add the norm, which is the (complex) squared magnitude
-                m_qli[i] += norm(m_qlmi[index]);
-                // This array gets populated by computeAve in the averaging case.
-                if (!m_average)
+                const auto normalizationfactor = float(4.0 * M_PI / m_num_ms[l_index]);
+                auto& qlmi = m_qlmi[l_index];
+                const size_t row = qlmi.getIndex({i, 0});
+                const size_t ql_index = m_qli.getIndex({i, l_index});
+                for (unsigned int k = 0; k < m_num_ms[l_index]; ++k)
                 {
-                    m_qlm_local.local()[k] += m_qlmi[index] / float(m_Np);
+                    // Cache the index for efficiency.
+                    const size_t index = row + k;
+                    qlmi[index] /= total_weight;
+                    // Add the norm, which is the (complex) squared magnitude
+                    m_qli[ql_index] += norm(qlmi[index]);
+                    // This array gets populated by computeAve in the averaging case.
+                    if (!m_average)
+                    {
+                        m_qlm_local[l_index].local()[k] += qlmi[index] / float(m_Np);
+                    }
                 }
+                m_qli[ql_index] *= normalizationfactor;
+                m_qli[ql_index] = std::sqrt(m_qli[ql_index]);
             }
-            m_qli[i] *= normalizationfactor;
-            m_qli[i] = std::sqrt(m_qli[i]);
         });
 }
 
-void Steinhardt::computeAve(const freud::locality::NeighborList* nlist,
-                            const freud::locality::NeighborQuery* points, freud::locality::QueryArgs qargs)
+void Steinhardt::computeAve(const freud::locality::NeighborList& nlist)
 {
-    std::shared_ptr<locality::NeighborQueryIterator> iter;
-    if (nlist == nullptr)
+    // The second shell average of particle i is
+    //     (qlm(i) + sum_{j in N(i)} sum_{k in N(j)} qlm(k)) / (1 + sum_{j in N(i)} |N(j)|),
+    // which is computed as two sparse products with the first-shell adjacency
+    // matrix A in CSR form: S = A qlm, followed by qlm(i) + (A S)(i). The CSR
+    // is taken directly from the (sorted) NeighborList.
+    const auto& counts = nlist.getCounts();
+    const auto& segments = nlist.getSegments();
+    const auto& neighbors = nlist.getNeighbors();
+
+    // Pack qlm for all l into one row per particle so that each sparse
+    // product streams over contiguous rows of width sum(2l+1).
+    const size_t num_l(m_l.size());
+    std::vector<size_t> offsets(num_l + 1, 0);
+    for (size_t l_index = 0; l_index < num_l; ++l_index)
     {
-        iter = points->query(points->getPoints(), points->getNPoints(), qargs);
+        offsets[l_index + 1] = offsets[l_index] + m_num_ms[l_index];
     }
+    const size_t width(offsets[num_l]);
 
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
+    util::ManagedArray<std::complex<float>> packed_qlmi({m_Np, width});
+    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            for (size_t l_index = 0; l_index < num_l; ++l_index)
+            {
+                std::copy_n(&m_qlmi[l_index](i, 0), m_num_ms[l_index],
+                            &packed_qlmi(i, offsets[l_index]));
+            }
+        }
+    });
 
-    freud::locality::loopOverNeighborsIterator(
-        points, points->getPoints(), m_Np, qargs, nlist,
-        [=](size_t i, const std::shared_ptr<freud::locality::NeighborPerPointIterator>& ppiter) {
-            unsigned int neighborcount(1);
-            for (freud::locality::NeighborBond nb1 = ppiter->next(); !ppiter->end(); nb1 = ppiter->next())
+    // First product: sum of the neighbors' qlm for each particle.
+    util::ManagedArray<std::complex<float>> shell_sums({m_Np, width});
+    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j)
+        {
+            std::complex<float>* shell_sum(&shell_sums(j, 0));
+            for (size_t bond = segments[j]; bond < segments[j] + counts[j]; ++bond)
             {
-                // Since we need to find neighbors of neighbors, we need to add some extra logic here to
-                // create the appropriate iterators.
-                std::shared_ptr<freud::locality::NeighborPerPointIterator> ns_neighbors_iter;
-                if (nlist != nullptr)
-                {
-                    ns_neighbors_iter
-                        = std::make_shared<locality::NeighborListPerPointIterator>(nlist, nb1.point_idx);
-                }
-                else
+                const std::complex<float>* qlmk(&packed_qlmi(neighbors(bond, 1), 0));
+                for (size_t k = 0; k < width; ++k)
                 {
-                    ns_neighbors_iter = iter->query(nb1.point_idx);
+                    shell_sum[k] += qlmk[k];
                 }
+            }
+        }
+    });
 
-                for (freud::locality::NeighborBond nb2 = ns_neighbors_iter->next(); !ns_neighbors_iter->end();
-                     nb2 = ns_neighbors_iter->next())
+    // Second product, including particle i itself, followed by normalization.
+    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+        std::vector<std::complex<float>> average(width);
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::copy_n(&packed_qlmi(i, 0), width, average.begin());
+            unsigned int neighborcount(1);
+            for (size_t bond = segments[i]; bond < segments[i] + counts[i]; ++bond)
+            {
+                const size_t j(neighbors(bond, 1));
+                const std::complex<float>* shell_sum(&shell_sums(j, 0));
+                for (size_t k = 0; k < width; ++k)
                 {
-                    for (unsigned int k = 0; k < m_num_ms; ++k)
-                    {
-                        // Adding all the qlm of the neighbors. We use the
-                        // vector function signature for indexing into the
-                        // arrays for speed.
-                        m_qlmiAve({static_cast<unsigned int>(i), k}) += m_qlmi({nb2.point_idx, k});
-                    }
-                    neighborcount++;
-                } // End loop over particle neighbor's bonds
-            }     // End loop over particle's bonds
+                    average[k] += shell_sum[k];
+                }
+                neighborcount += counts[j];
+            }
 
             // Normalize!
-            for (unsigned int k = 0; k < m_num_ms; ++k)
+            for (size_t l_index = 0; l_index < num_l; ++l_index)
             {
-                // Cache the index for efficiency.
-                const unsigned int index = m_qlmiAve.getIndex({static_cast<unsigned int>(i), k});
-                // Adding the qlm of the particle i itself
-                m_qlmiAve[index] += m_qlmi[index];
-                m_qlmiAve[index] /= static_cast<float>(neighborcount);
-                m_qlm_local.local()[k] += m_qlmiAve[index] / float(m_Np);
-                // Add the norm, which is the complex squared magnitude
-                m_qliAve[i] += norm(m_qlmiAve[index]);
+                const auto normalizationfactor = float(4.0 * M_PI / m_num_ms[l_index]);
+                auto& qlmiAve = m_qlmiAve[l_index];
+                const size_t row = qlmiAve.getIndex({i, 0});
+                const size_t ql_index = m_qliAve.getIndex({i, l_index});
+                for (unsigned int k = 0; k < m_num_ms[l_index]; ++k)
+                {
+                    // Cache the index for efficiency.
+                    const size_t index = row + k;
+                    qlmiAve[index] = average[offsets[l_index] + k] / static_cast<float>(neighborcount);
+                    m_qlm_local[l_index].local()[k] += qlmiAve[index] / float(m_Np);
+                    // Add the norm, which is the complex squared magnitude
+                    m_qliAve[ql_index] += norm(qlmiAve[index]);
+                }
+                m_qliAve[ql_index] *= normalizationfactor;
+                m_qliAve[ql_index] = std::sqrt(m_qliAve[ql_index]);
             }
-            m_qliAve[i] *= normalizationfactor;
-            m_qliAve[i] = std::sqrt(m_qliAve[i]);
-        });
+        }
+    });
 }
 
-float Steinhardt::normalizeSystem()
+void Steinhardt::normalizeSystem()
 {
-    float calc_norm(0);
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
-    for (unsigned int k = 0; k < m_num_ms; ++k)
+    for (size_t l_index = 0; l_index < m_l.size(); ++l_index)
     {
-        // Add the norm, which is the complex squared magnitude
-        calc_norm += norm(m_qlm[k]);
-    }
-    const float ql_system_norm = std::sqrt(calc_norm * normalizationfactor);
+        float calc_norm(0);
+        const auto normalizationfactor = float(4.0 * M_PI / m_num_ms[l_index]);
+        for (unsigned int k = 0; k < m_num_ms[l_index]; ++k)
+        {
+            // Add the norm, which is the complex squared magnitude
+            calc_norm += norm(m_qlm[l_index][k]);
+        }
+        const float ql_system_norm = std::sqrt(calc_norm * normalizationfactor);
 
-    if (m_wl)
-    {
-        auto wigner3jvalues = getWigner3j(m_l);
-        float wl_system_norm = reduceWigner3j(m_qlm.get(), m_l, wigner3jvalues);
+        if (m_wl)
+        {
+            const Wigner3jTriples& wigner3j = getWigner3j(m_l[l_index]);
+            float wl_system_norm = reduceWigner3j(m_qlm[l_index].get(), wigner3j);
 
-        // The normalization factor of wl is calculated using qli, which is
-        // equivalent to calculate the normalization factor from qlmi
-        if (m_wl_normalize)
+            // The normalization factor of wl is calculated using qli, which is
+            // equivalent to calculate the normalization factor from qlmi
+            if (m_wl_normalize)
+            {
+                const float wl_normalization = std::sqrt(normalizationfactor) / ql_system_norm;
+                wl_system_norm *= wl_normalization * wl_normalization * wl_normalization;
+            }
+            m_norm[l_index] = wl_system_norm;
+        }
+        else
         {
-            const float wl_normalization = std::sqrt(normalizationfactor) / ql_system_norm;
-            wl_system_norm *= wl_normalization * wl_normalization * wl_normalization;
+            m_norm[l_index] = ql_system_norm;
         }
-        return wl_system_norm;
     }
-
-    return ql_system_norm;
 }
 
 void Steinhardt::aggregatewl(util::ManagedArray<float>& target,
-                             const util::ManagedArray<std::complex<float>>& source,
+                             const std::vector<util::ManagedArray<std::complex<float>>>& source,
                              const util::ManagedArray<float>& normalization_source) const
 {
-    auto wigner3jvalues = getWigner3j(m_l);
-    const auto normalizationfactor = float(4.0 * M_PI / m_num_ms);
-    util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
-        for (size_t i = begin; i < end; ++i)
-        {
-            target[i] = reduceWigner3j(&(source({static_cast<unsigned int>(i), 0})), m_l, wigner3jvalues);
-            if (m_wl_normalize)
+    for (size_t l_index = 0; l_index < m_l.size(); ++l_index)
+    {
+        const unsigned int l(m_l[l_index]);
+        const Wigner3jTriples& wigner3j = getWigner3j(l);
+        const auto normalizationfactor = float(4.0 * M_PI / m_num_ms[l_index]);
+        util::forLoopWrapper(0, m_Np, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
             {
-                const float normalization = std::sqrt(normalizationfactor) / normalization_source[i];
-                target[i] *= normalization * normalization * normalization;
+                const size_t index = target.getIndex({i, l_index});
+                target[index] = reduceWigner3j(&(source[l_index]({i, 0})), wigner3j);
+                if (m_wl_normalize)
+                {
+                    const float normalization = std::sqrt(normalizationfactor) / normalization_source[index];
+                    target[index] *= normalization * normalization * normalization;
+                }
             }
-        }
-    });
+        });
+    }
 }
 
 }; }; // end namespace freud::order
@@ -5,15 +5,16 @@
 #define STEINHARDT_H
 
 #include <complex>
+#include <vector>
 
 #include "Box.h"
 #include "ManagedArray.h"
 #include "NeighborList.h"
 #include "NeighborQuery.h"
+#include "SphericalHarmonics.h"
 #include "ThreadStorage.h"
 #include "VectorMath.h"
 #include "Wigner3j.h"
-#include "fsph/src/spherical_harmonics.hpp"
 
 /*! \file Steinhardt.h
     \brief Computes variants of Steinhardt order parameters.
@@ -48,6 +49,10 @@ namespace freud { namespace order {
  * If the flag wl_normalize is set, the third-order invariant wl order parameter
  * will be normalized.
  *
+ * Multiple values of l may be requested at once. The spherical harmonics of
+ * each bond are then evaluated a single time up to the largest l, and all
+ * per-particle outputs gain a trailing dimension indexing the requested l.
+ *
  * For more details see:
  * - PJ Steinhardt (1983) (DOI: 10.1103/PhysRevB.28.784)
  * - Wolfgang Lechner (2008) (DOI: 10.1063/Journal of Chemical Physics 129.114707)
@@ -58,14 +63,16 @@ class Steinhardt
 public:
     //! Steinhardt Class Constructor
     /*! Constructor for Steinhardt analysis class.
-     *  \param l Spherical harmonic number l.
-     *           Must be a positive number.
+     *  \param l Spherical harmonic numbers l to compute in a single pass.
+     *           Must be a non-empty list of non-negative numbers.
      */
+    explicit Steinhardt(std::vector<unsigned int> l, bool average = false, bool wl = false,
+                        bool weighted = false, bool wl_normalize = false);
+
+    //! Steinhardt Class Constructor for a single spherical harmonic number l.
     explicit Steinhardt(unsigned int l, bool average = false, bool wl = false, bool weighted = false,
                         bool wl_normalize = false)
-        : m_l(l), m_num_ms(2 * l + 1), m_average(average), m_wl(wl), m_weighted(weighted),
-          m_wl_normalize(wl_normalize), m_qlm_local(2 * l + 1)
-
+        : Steinhardt(std::vector<unsigned int> {l}, average, wl, weighted, wl_normalize)
     {}
 
     //! Empty destructor
@@ -77,7 +84,7 @@ public:
         return m_Np;
     }
 
-    //! Get the last calculated order parameter
+    //! Get the last calculated order parameter with shape (N, n_l)
     const util::ManagedArray<float>& getParticleOrder() const
     {
         if (m_wl)
@@ -87,7 +94,7 @@ public:
         return getQl();
     }
 
-    //! Get the last calculated ql
+    //! Get the last calculated ql with shape (N, n_l)
     const util::ManagedArray<float>& getQl() const
     {
         if (m_average)
@@ -97,14 +104,14 @@ public:
         return m_qli;
     }
 
-    //! Get the last calculated qlm for each particle
-    const util::ManagedArray<std::complex<float>>& getQlm() const
+    //! Get the last calculated qlm for each particle, one (N, 2l+1) array per l
+    const std::vector<util::ManagedArray<std::complex<float>>>& getQlm() const
     {
         return m_qlmi;
     }
 
-    //! Get system-normalized order
-    float getOrder() const
+    //! Get system-normalized order for each l
+    const util::ManagedArray<float>& getOrder() const
     {
         return m_norm;
     }
@@ -137,19 +144,13 @@ public:
     void compute(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
                  freud::locality::QueryArgs qargs);
 
-    unsigned int getL() const
+    //! Get the spherical harmonic numbers l
+    const std::vector<unsigned int>& getL() const
     {
         return m_l;
     }
 
 private:
-    //! \internal
-    //! Spherical harmonics calculation for Ylm filling a
-    //  std::vector<std::complex<float> > with values for m = -l..l.
-    void computeYlm(const float theta, const float phi, std::vector<std::complex<float>>& Ylm) const;
-
-    template<typename T> std::shared_ptr<T> makeArray(size_t size);
-
     //! Reallocates only the necessary arrays when the number of particles changes
     // unsigned int Np number of particles
     void reallocateArrays(unsigned int Np);
@@ -158,23 +159,24 @@ private:
     void baseCompute(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
                      freud::locality::QueryArgs qargs);
 
-    //! Calculates the neighbor average ql order parameter
-    void computeAve(const freud::locality::NeighborList* nlist, const freud::locality::NeighborQuery* points,
-                    freud::locality::QueryArgs qargs);
+    //! Calculates the neighbor average ql order parameter from the first shell neighbors
+    void computeAve(const freud::locality::NeighborList& nlist);
 
-    //! Compute the system-wide order by averaging over particles, then
-    //  reducing over the m values to produce a single scalar.
-    float normalizeSystem();
+    //! Compute the system-wide order for each l by averaging over particles,
+    //  then reducing over the m values to produce a single scalar per l.
+    void normalizeSystem();
 
     //! Sum over Wigner 3j coefficients to compute third-order invariants
     //  wl from second-order invariants ql
-    void aggregatewl(util::ManagedArray<float>& target, const util::ManagedArray<std::complex<float>>& source,
+    void aggregatewl(util::ManagedArray<float>& target,
+                     const std::vector<util::ManagedArray<std::complex<float>>>& source,
                      const util::ManagedArray<float>& normalization_source) const;
 
     // Member variables used for compute
-    unsigned int m_Np {0}; //!< Last number of points computed
-    unsigned int m_l;      //!< Spherical harmonic l value.
-    unsigned int m_num_ms; //!< The number of magnetic quantum numbers (2*m_l+1).
+    unsigned int m_Np {0};              //!< Last number of points computed
+    std::vector<unsigned int> m_l;      //!< Spherical harmonic l values.
+    std::vector<unsigned int> m_num_ms; //!< The number of magnetic quantum numbers (2*l+1) for each l.
+    unsigned int m_l_max {0};           //!< Largest requested l, which sets the size of each Ylm evaluation.
 
     // Flags
     bool m_average;      //!< Whether to take a second shell average (default false)
@@ -182,17 +184,17 @@ private:
     bool m_weighted;     //!< Whether to use neighbor weights in computing qlmi (default false)
     bool m_wl_normalize; //!< Whether to normalize the third-order invariant wl (default false)
 
-    util::ManagedArray<std::complex<float>> m_qlmi;       //!< qlm for each particle i
-    util::ManagedArray<std::complex<float>> m_qlm;        //!< Normalized qlm(Ave) for the whole system
-    util::ThreadStorage<std::complex<float>> m_qlm_local; //!< Thread-specific m_qlm(Ave)
-    util::ManagedArray<float> m_qli;    //!< ql locally invariant order parameter for each particle i
-    util::ManagedArray<float> m_qliAve; //!< Averaged ql with 2nd neighbor shell for each particle i
-    util::ManagedArray<std::complex<float>>
-        m_qlmiAve; //!< Averaged qlm with 2nd neighbor shell for each particle i
-    util::ManagedArray<std::complex<float>> m_qlmAve; //!< Normalized qlmiAve for the whole system
-    float m_norm {0};                                 //!< System normalized order parameter
+    std::vector<util::ManagedArray<std::complex<float>>> m_qlmi; //!< qlm for each particle i, per l
+    std::vector<util::ManagedArray<std::complex<float>>>
+        m_qlm; //!< Normalized qlm(Ave) for the whole system, per l
+    std::vector<util::ThreadStorage<std::complex<float>>> m_qlm_local; //!< Thread-specific m_qlm(Ave), per l
+    util::ManagedArray<float> m_qli;    //!< ql locally invariant order parameter for each particle i and l
+    util::ManagedArray<float> m_qliAve; //!< Averaged ql with 2nd neighbor shell for each particle i and l
+    std::vector<util::ManagedArray<std::complex<float>>>
+        m_qlmiAve;                    //!< Averaged qlm with 2nd neighbor shell for each particle i, per l
+    util::ManagedArray<float> m_norm; //!< System normalized order parameter for each l
     util::ManagedArray<float>
-        m_wli; //!< wl order parameter for each particle i, also used for wl averaged data
+        m_wli; //!< wl order parameter for each particle i and l, also used for wl averaged data
 };
 
 }; };  // end namespace freud::order
@@ -8,7 +8,7 @@
 #include <vector>
 
 /*! \file Wigner3j.h
- *  \brief Stores and reduces over Wigner 3j coefficients for l from 0 to 20
+ *  \brief Generates and reduces over Wigner 3j coefficients (l l l; m1 m2 m3)
  */
 
 namespace freud { namespace order {
@@ -17,49 +17,37 @@ namespace freud { namespace order {
 //  [0, 1, ..., l, -1, -2, ..., -l]
 int lmIndex(int l, int m);
 
+//! Nonzero Wigner 3j coefficients (l l l; m1 m2 m3) for a single l.
+/*! Since all three j are equal, the coefficient of every permutation of
+ *  (m1, m2, m3) is the same up to the sign (-1)^l of odd permutations. Only
+ *  one triple m1 <= m2 <= m3 with m1 + m2 + m3 = 0 is stored for each set of
+ *  permutations, with the coefficient multiplied by the number of distinct
+ *  permutations. For odd l the permutations cancel, so the list is empty.
+ */
+struct Wigner3jTriples
+{
+    std::vector<unsigned int> m1_index; //!< lmIndex of m1 for each triple
+    std::vector<unsigned int> m2_index; //!< lmIndex of m2 for each triple
+    std::vector<unsigned int> m3_index; //!< lmIndex of m3 for each triple
+    std::vector<float> coefficient;     //!< Coefficient times the number of distinct permutations
+};
+
+//! Get the Wigner 3j triples for l.
+/*! Coefficients are generated on first use by a Schulten-Gordon recursion
+ *  in m2 and cached, so any l is supported. This function is thread safe.
+ */
+const Wigner3jTriples& getWigner3j(unsigned int l);
+
+//! Compute the Wigner 3j coefficients (l l l; m1 m2 m3) for all m1, m2.
+/*! The result is indexed as [(m1 + l) * (2l + 1) + (m2 + l)], with
+ *  m3 = -m1 - m2. Entries with |m3| > l are zero.
+ */
+std::vector<double> computeWigner3j(unsigned int l);
+
 //! Reduce an array using Wigner 3j coefficients to construct a
 //  third-order rotational invariant quantity.
 //  source array must be indexed by m, like [0, 1, ..., l, -1, -2, ..., -l].
-float reduceWigner3j(const std::complex<float>* source, unsigned int l_, const std::vector<double>& wigner3j);
-
-std::vector<double> getWigner3j(unsigned int l);
-// All Wigner 3j coefficients created using sympy
-/*
-
-from sympy.physics.wigner import wigner_3j
-import numpy as np
-import json
-
-wigner = {}
-for l in range(21):
-    wigner[l] = []
-    for m1 in range(-l, l+1):
-        for m2 in range(max(-l-m1, -l), min(l-m1, l)+1):
-            m3 = -m1-m2
-            wigner[l].append(float(wigner_3j(l, l, l, m1, m2, m3)))
-
-with open('wigner3j.json', 'w') as jsonfile:
-    json.dump(wigner, jsonfile, sort_keys=True, indent=4)
-
-WIGNER_COEFF = """
-    case {l}:
-    {{
-        return {{
-{values}
-        }};
-    }}"""
-
-def format_values(values, per_line=4, spaces=12):
-    lines = []
-    for line in range(int(np.ceil(len(values)/per_line))):
-        lines.append(', '.join(
-            map(str, values[line*per_line:min(len(values), (line+1)*per_line)])))
-    return ' '*spaces + (',\n' + ' '*spaces).join(lines)
-
-for l in sorted(wigner.keys()):
-    print(WIGNER_COEFF.format(l=l, values=format_values(wigner[l])))
-
-*/
+float reduceWigner3j(const std::complex<float>* source, const Wigner3jTriples& wigner3j);
 
 }; };  // end namespace freud::order
 #endif // WIGNER3J_H
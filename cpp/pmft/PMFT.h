@@ -5,12 +5,14 @@
 #define PMFT_H
 
 #include <tbb/tbb.h>
+#include <vector>
 
 #include "BondHistogramCompute.h"
 #include "Box.h"
 #include "Histogram.h"
 #include "ManagedArray.h"
 #include "VectorMath.h"
+#include "utils.h"
 
 /*! \internal
     \file PMFT.h
@@ -78,6 +80,22 @@ protected:
         });
     }
 
+    //! Compute the unit vector (cos(angle), sin(angle)) of each 2D orientation.
+    /*! 2D PMFTs rotate bonds and measure relative angles using these vectors,
+     *  so each orientation costs one sin and cos rather than each bond.
+     */
+    static std::vector<vec2<float>> orientationVectors(const float* angles, unsigned int n)
+    {
+        std::vector<vec2<float>> vectors(n);
+        util::forLoopWrapper(0, n, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                vectors[i] = vec2<float>(std::cos(angles[i]), std::sin(angles[i]));
+            }
+        });
+        return vectors;
+    }
+
     util::ManagedArray<float> m_pcf_array; //!< Array of computed pair correlation function.
 };
 
@@ -1,7 +1,9 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <array>
 #include <stdexcept>
+#include <vector>
 
 #include "PMFTR12.h"
 #include "utils.h"
@@ -47,32 +49,25 @@ PMFTR12::PMFTR12(float r_max, unsigned int n_r, unsigned int n_t1, unsigned int
     // this factor for dt1 because it is part of the real space volume for the
     // central particle, see PMFT::reduce for more information.
     //
-    // The array is computed as the inverse for faster use later.
-    m_inv_jacobian_array.prepare({n_r, n_t1, n_t2});
+    // The Jacobian only depends on r, so the inverse is stored for each
+    // radial bin rather than for every bin for faster use later.
     std::vector<float> bins_r = m_histogram.getBinCenters()[0];
     float dr = r_max / float(n_r);
     float dt1 = constants::TWO_PI / float(n_t1);
     float dt2 = 1 / float(n_t2);
     float product = dr * dt1 * dt2;
+    m_inv_jacobian_r.resize(n_r);
     for (unsigned int i = 0; i < n_r; i++)
     {
-        float r = bins_r[i];
-        for (unsigned int j = 0; j < n_t1; j++)
-        {
-            for (unsigned int k = 0; k < n_t2; k++)
-            {
-                m_inv_jacobian_array(i, j, k) = (float) 1.0 / (r * product);
-            }
-        }
+        m_inv_jacobian_r[i] = (float) 1.0 / (bins_r[i] * product);
     }
-
-    // Create the PCF array.
-    m_pcf_array.prepare({n_r, n_t1, n_t2});
 }
 
 void PMFTR12::reduce()
 {
-    PMFT::reduce([this](size_t i) { return m_inv_jacobian_array[i]; });
+    const std::vector<size_t> sizes(getAxisSizes());
+    const size_t r_stride = sizes[1] * sizes[2];
+    PMFT::reduce([this, r_stride](size_t i) { return m_inv_jacobian_r[i / r_stride]; });
 }
 
 void PMFTR12::accumulate(const locality::NeighborQuery* neighbor_query, const float* orientations,
@@ -81,19 +76,38 @@ void PMFTR12::accumulate(const locality::NeighborQuery* neighbor_query, const fl
                          freud::locality::QueryArgs qargs)
 {
     neighbor_query->getBox().enforce2D();
+    const std::vector<vec2<float>> directions(orientationVectors(orientations, neighbor_query->getNPoints()));
+    const std::vector<vec2<float>> query_directions(orientationVectors(query_orientations, n_query_points));
     accumulateGeneral(neighbor_query, query_points, n_query_points, nlist, qargs,
-                      [=](const freud::locality::NeighborBond& neighbor_bond) {
-                          vec3<float> delta(bondVector(neighbor_bond, neighbor_query, query_points));
-                          // calculate angles
-                          float d_theta1 = std::atan2(delta.y, delta.x);
-                          float d_theta2 = std::atan2(-delta.y, -delta.x);
-                          float t1 = orientations[neighbor_bond.point_idx] - d_theta1;
-                          float t2 = query_orientations[neighbor_bond.query_point_idx] - d_theta2;
-                          // make sure that t1, t2 are bounded between 0 and 2PI
-                          t1 = util::modulusPositive(t1, constants::TWO_PI);
-                          t2 = util::modulusPositive(t2, constants::TWO_PI);
-                          m_local_histograms(neighbor_bond.distance, t1, t2);
+                      [&](const freud::locality::NeighborBond& neighbor_bond) {
+                          const vec3<float> delta(bondVector(neighbor_bond, neighbor_query, query_points));
+                          // t1 is the orientation of the point minus the angle of the bond,
+                          // and t2 is the orientation of the query point minus the angle of
+                          // the reversed bond. Their direction vectors are the complex
+                          // products of the orientation vectors with the conjugate bond.
+                          const vec2<float>& u = directions[neighbor_bond.point_idx];
+                          const vec2<float>& v = query_directions[neighbor_bond.query_point_idx];
+                          const float t1 = util::angle2D(u.y * delta.x - u.x * delta.y,
+                                                         u.x * delta.x + u.y * delta.y);
+                          const float t2 = util::angle2D(v.x * delta.y - v.y * delta.x,
+                                                         -v.x * delta.x - v.y * delta.y);
+                          BondHistogram& local_histogram(m_local_histograms.local());
+                          local_histogram.increment(
+                              local_histogram.bin(std::array<float, 3> {neighbor_bond.distance, t1, t2}));
                       });
 }
 
+void PMFTR12::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                                   const float* orientations, unsigned int n_frames, unsigned int n_points,
+                                   freud::locality::QueryArgs qargs)
+{
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t frame) {
+            const float* frame_orientations = orientations + frame * n_points;
+            accumulate(neighbor_query, frame_orientations, neighbor_query->getPoints(), frame_orientations,
+                       n_points, nullptr, qargs);
+        });
+}
+
 }; }; // end namespace freud::pmft
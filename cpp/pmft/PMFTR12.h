@@ -4,6 +4,8 @@
 #ifndef PMFTR12_H
 #define PMFTR12_H
 
+#include <vector>
+
 #include "PMFT.h"
 
 /*! \file PMFTR12.h
@@ -26,12 +28,18 @@ public:
                     unsigned int n_query_points, const locality::NeighborList* nlist,
                     freud::locality::QueryArgs qargs);
 
+    //! Accumulate all frames of a trajectory, using the points of each frame as the query points.
+    /*! \param orientations The orientations of all frames, with n_points consecutive angles per frame.
+     */
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points, const float* orientations,
+                              unsigned int n_frames, unsigned int n_points, freud::locality::QueryArgs qargs);
+
 protected:
     //! \internal
     //! helper function to reduce the thread specific arrays into one array
     void reduce() override;
 
-    util::ManagedArray<float> m_inv_jacobian_array; //!< Array of inverse jacobians for each bin
+    std::vector<float> m_inv_jacobian_r; //!< Inverse jacobian for each radial bin
 };
 
 }; }; // end namespace freud::pmft
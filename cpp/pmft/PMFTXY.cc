@@ -39,9 +39,6 @@ PMFTXY::PMFTXY(float x_max, float y_max, unsigned int n_x, unsigned int n_y) : P
     const float dy = float(2.0) * y_max / float(n_y);
     m_jacobian = dx * dy;
 
-    // Create the PCF array.
-    m_pcf_array.prepare({n_x, n_y});
-
     // Construct the Histogram object that will be used to keep track of counts of bond distances found.
     BHAxes axes;
     axes.push_back(std::make_shared<util::RegularAxis>(n_x, -x_max, x_max));
@@ -75,4 +72,16 @@ void PMFTXY::accumulate(const locality::NeighborQuery* neighbor_query, const flo
                       });
 }
 
+void PMFTXY::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                                  const float* query_orientations, unsigned int n_frames,
+                                  unsigned int n_points, freud::locality::QueryArgs qargs)
+{
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t frame) {
+            accumulate(neighbor_query, query_orientations + frame * n_points, neighbor_query->getPoints(),
+                       n_points, nullptr, qargs);
+        });
+}
+
 }; }; // end namespace freud::pmft
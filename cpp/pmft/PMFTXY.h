@@ -25,6 +25,14 @@ public:
                     const vec3<float>* query_points, unsigned int n_query_points,
                     const locality::NeighborList* nlist, freud::locality::QueryArgs qargs);
 
+    //! Accumulate all frames of a trajectory, using the points of each frame as the query points.
+    /*! \param query_orientations The orientations of all frames, with n_points consecutive angles per
+     *         frame.
+     */
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                              const float* query_orientations, unsigned int n_frames, unsigned int n_points,
+                              freud::locality::QueryArgs qargs);
+
 protected:
     //! \internal
     //! helper function to reduce the thread specific arrays into one array
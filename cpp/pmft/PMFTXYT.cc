@@ -1,7 +1,9 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
+#include <array>
 #include <stdexcept>
+#include <vector>
 
 #include "PMFTXYT.h"
 #include "utils.h"
@@ -45,9 +47,6 @@ PMFTXYT::PMFTXYT(float x_max, float y_max, unsigned int n_x, unsigned int n_y, u
     const float dt = 1 / float(n_t);
     m_jacobian = dx * dy * dt;
 
-    // Create the PCF array.
-    m_pcf_array.prepare({n_x, n_y, n_t});
-
     // Construct the Histogram object that will be used to keep track of counts of bond distances found.
     BondHistogram::Axes axes;
     axes.push_back(std::make_shared<util::RegularAxis>(n_x, -x_max, x_max));
@@ -69,21 +68,36 @@ void PMFTXYT::accumulate(const locality::NeighborQuery* neighbor_query, const fl
                          freud::locality::QueryArgs qargs)
 {
     neighbor_query->getBox().enforce2D();
+    const std::vector<vec2<float>> directions(orientationVectors(orientations, neighbor_query->getNPoints()));
+    const std::vector<vec2<float>> query_directions(orientationVectors(query_orientations, n_query_points));
     accumulateGeneral(neighbor_query, query_points, n_query_points, nlist, qargs,
-                      [=](const freud::locality::NeighborBond& neighbor_bond) {
-                          vec3<float> delta(bondVector(neighbor_bond, neighbor_query, query_points));
-
-                          // rotate interparticle vector
-                          vec2<float> myVec(delta.x, delta.y);
-                          rotmat2<float> myMat
-                              = rotmat2<float>::fromAngle(-query_orientations[neighbor_bond.query_point_idx]);
-                          vec2<float> rotVec = myMat * myVec;
-                          // calculate angle
-                          float d_theta = std::atan2(-delta.y, -delta.x);
-                          float t = orientations[neighbor_bond.point_idx] - d_theta;
-                          // make sure that t is bounded between 0 and 2PI
-                          t = util::modulusPositive(t, constants::TWO_PI);
-                          m_local_histograms(rotVec.x, rotVec.y, t);
+                      [&](const freud::locality::NeighborBond& neighbor_bond) {
+                          const vec3<float> delta(bondVector(neighbor_bond, neighbor_query, query_points));
+                          // rotate the interparticle vector into the frame of the query point
+                          const vec2<float>& v = query_directions[neighbor_bond.query_point_idx];
+                          const float x = v.x * delta.x + v.y * delta.y;
+                          const float y = v.x * delta.y - v.y * delta.x;
+                          // t is the orientation of the point minus the angle of the reversed
+                          // bond, whose direction vector is the complex product of the
+                          // orientation vector with the conjugate reversed bond.
+                          const vec2<float>& u = directions[neighbor_bond.point_idx];
+                          const float t = util::angle2D(u.x * delta.y - u.y * delta.x,
+                                                        -u.x * delta.x - u.y * delta.y);
+                          BondHistogram& local_histogram(m_local_histograms.local());
+                          local_histogram.increment(local_histogram.bin(std::array<float, 3> {x, y, t}));
                       });
 }
+
+void PMFTXYT::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                                   const float* orientations, unsigned int n_frames, unsigned int n_points,
+                                   freud::locality::QueryArgs qargs)
+{
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t frame) {
+            const float* frame_orientations = orientations + frame * n_points;
+            accumulate(neighbor_query, frame_orientations, neighbor_query->getPoints(), frame_orientations,
+                       n_points, nullptr, qargs);
+        });
+}
 }; }; // end namespace freud::pmft
@@ -1,8 +1,12 @@
 // Copyright (c) 2010-2020 The Regents of the University of Michigan
 // This file is from the freud project, released under the BSD 3-Clause License.
 
-#include "PMFTXYZ.h"
+#include <algorithm>
+#include <array>
 #include <stdexcept>
+#include <vector>
+
+#include "PMFTXYZ.h"
 
 /*! \file PMFTXYZ.cc
     \brief Routines for computing 3D potential of mean force in XYZ coordinates
@@ -60,9 +64,6 @@ PMFTXYZ::PMFTXYZ(float x_max, float y_max, float z_max, unsigned int n_x, unsign
     // PMFT::reduce for more information.
     m_jacobian = dx * dy * dz;
 
-    // Create the PCF array.
-    m_pcf_array.prepare({n_x, n_y, n_z});
-
     // Construct the Histogram object that will be used to keep track of counts
     // of bond distances found.
     BHAxes axes;
@@ -97,10 +98,7 @@ void PMFTXYZ::reset()
     m_num_equiv_orientations = 0xffffffff;
 }
 
-void PMFTXYZ::accumulate(const locality::NeighborQuery* neighbor_query, const quat<float>* query_orientations,
-                         const vec3<float>* query_points, unsigned int n_query_points,
-                         const quat<float>* equiv_orientations, unsigned int num_equiv_orientations,
-                         const locality::NeighborList* nlist, freud::locality::QueryArgs qargs)
+void PMFTXYZ::setNumEquivOrientations(unsigned int num_equiv_orientations)
 {
     // Set the number of equivalent orientations the first time we compute
     // (after a reset), then error on subsequent calls if it changes.
@@ -113,25 +111,92 @@ void PMFTXYZ::accumulate(const locality::NeighborQuery* neighbor_query, const qu
         throw std::runtime_error(
             "The number of equivalent orientations must be constant while accumulating data into PMFTXYZ.");
     }
+}
+
+void PMFTXYZ::accumulate(const locality::NeighborQuery* neighbor_query, const quat<float>* query_orientations,
+                         const vec3<float>* query_points, unsigned int n_query_points,
+                         const quat<float>* equiv_orientations, unsigned int num_equiv_orientations,
+                         const locality::NeighborList* nlist, freud::locality::QueryArgs qargs)
+{
+    setNumEquivOrientations(num_equiv_orientations);
     neighbor_query->getBox().enforce3D();
-    accumulateGeneral(neighbor_query, query_points, n_query_points, nlist, qargs,
-                      [=](const freud::locality::NeighborBond& neighbor_bond) {
-                          // create the reference point quaternion
-                          quat<float> query_orientation(query_orientations[neighbor_bond.query_point_idx]);
-                          // make sure that the particles are wrapped into the box
-                          vec3<float> delta(bondVector(neighbor_bond, neighbor_query, query_points));
-
-                          for (unsigned int k = 0; k < num_equiv_orientations; k++)
-                          {
-                              // create point vector
-                              vec3<float> v(delta);
-                              // rotate the vector
-                              v = rotate(conj(query_orientation), v);
-                              v = rotate(equiv_orientations[k], v);
-
-                              m_local_histograms(v.x, v.y, v.z);
-                          }
-                      });
+
+    // Precompute the rotation into the frame of each query point, and the
+    // matrices of the equivalent orientations stored by component so that a
+    // bond can be rotated by all of them in a single vectorizable loop.
+    std::vector<rotmat3<float>> query_rotations(n_query_points);
+    util::forLoopWrapper(0, n_query_points, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            query_rotations[i] = rotmat3<float>(conj(query_orientations[i]));
+        }
+    });
+    std::vector<float> equiv_rotations(9 * num_equiv_orientations);
+    for (unsigned int k = 0; k < num_equiv_orientations; k++)
+    {
+        const rotmat3<float> rotation(equiv_orientations[k]);
+        const std::array<vec3<float>, 3> rows = {rotation.row0, rotation.row1, rotation.row2};
+        for (unsigned int row = 0; row < 3; row++)
+        {
+            equiv_rotations[(3 * row + 0) * num_equiv_orientations + k] = rows[row].x;
+            equiv_rotations[(3 * row + 1) * num_equiv_orientations + k] = rows[row].y;
+            equiv_rotations[(3 * row + 2) * num_equiv_orientations + k] = rows[row].z;
+        }
+    }
+
+    accumulateGeneral(
+        neighbor_query, query_points, n_query_points, nlist, qargs,
+        [&](const freud::locality::NeighborBond& neighbor_bond) {
+            // rotate the bond vector into the frame of the query point
+            const vec3<float> v(query_rotations[neighbor_bond.query_point_idx]
+                                * bondVector(neighbor_bond, neighbor_query, query_points));
+            BondHistogram& local_histogram(m_local_histograms.local());
+
+            // rotate by the equivalent orientations in fixed size blocks
+            constexpr unsigned int block_size = 32;
+            std::array<float, block_size> x;
+            std::array<float, block_size> y;
+            std::array<float, block_size> z;
+            for (unsigned int block = 0; block < num_equiv_orientations; block += block_size)
+            {
+                const unsigned int n = std::min(block_size, num_equiv_orientations - block);
+                const float* r(equiv_rotations.data() + block);
+                const size_t stride = num_equiv_orientations;
+                for (unsigned int k = 0; k < n; k++)
+                {
+                    x[k] = r[k] * v.x + r[stride + k] * v.y + r[2 * stride + k] * v.z;
+                    y[k] = r[3 * stride + k] * v.x + r[4 * stride + k] * v.y + r[5 * stride + k] * v.z;
+                    z[k] = r[6 * stride + k] * v.x + r[7 * stride + k] * v.y + r[8 * stride + k] * v.z;
+                }
+                for (unsigned int k = 0; k < n; k++)
+                {
+                    local_histogram.increment(local_histogram.bin(std::array<float, 3> {x[k], y[k], z[k]}));
+                }
+            }
+        });
+}
+
+void PMFTXYZ::accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                                   const quat<float>* query_orientations, unsigned int n_frames,
+                                   unsigned int n_points, const quat<float>* equiv_orientations,
+                                   unsigned int num_equiv_orientations, freud::locality::QueryArgs qargs)
+{
+    // The number of equivalent orientations is checked before the frames are
+    // accumulated in parallel, so the frames only read it.
+    setNumEquivOrientations(num_equiv_orientations);
+    BondHistogramCompute::accumulateTrajectory(
+        boxes, points, n_frames, n_points,
+        [&](const freud::locality::NeighborQuery* neighbor_query, size_t frame) {
+            // The query points are shifted by the shift vector, as in compute.
+            std::vector<vec3<float>> query_points(neighbor_query->getPoints(),
+                                                  neighbor_query->getPoints() + n_points);
+            for (auto& query_point : query_points)
+            {
+                query_point -= m_shiftvec;
+            }
+            accumulate(neighbor_query, query_orientations + frame * n_points, query_points.data(), n_points,
+                       equiv_orientations, num_equiv_orientations, nullptr, qargs);
+        });
 }
 
 }; }; // end namespace freud::pmft
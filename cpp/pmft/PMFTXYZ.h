@@ -27,6 +27,15 @@ public:
                     const quat<float>* equiv_orientations, unsigned int num_equiv_orientations,
                     const locality::NeighborList* nlist, freud::locality::QueryArgs qargs);
 
+    //! Accumulate all frames of a trajectory, using the points of each frame as the query points.
+    /*! \param query_orientations The orientations of all frames, with n_points consecutive orientations
+     *         per frame.
+     */
+    void accumulateTrajectory(const box::Box* boxes, const vec3<float>* points,
+                              const quat<float>* query_orientations, unsigned int n_frames,
+                              unsigned int n_points, const quat<float>* equiv_orientations,
+                              unsigned int num_equiv_orientations, freud::locality::QueryArgs qargs);
+
     //! Reset the PMFT
     /*! Override the parent method to also reset the number of equivalent orientations.
      */
@@ -37,6 +46,9 @@ protected:
     //! helper function to reduce the thread specific arrays into one array
     void reduce() override;
 
+    //! Set the number of equivalent orientations, or check that it matches the previous accumulations.
+    void setNumEquivOrientations(unsigned int num_equiv_orientations);
+
     float m_jacobian;
     vec3<float> m_shiftvec;                //!< vector that points from [0,0,0] to the origin of the pmft
     unsigned int m_num_equiv_orientations; //!< The number of equivalent orientations used in the current
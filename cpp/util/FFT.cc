@@ -0,0 +1,78 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "FFT.h"
+
+/*! \file FFT.cc
+    \brief Minimal fast Fourier transform used for time correlation functions.
+*/
+
+namespace freud { namespace util {
+
+size_t nextPowerOfTwo(size_t n)
+{
+    size_t power = 1;
+    while (power < n)
+    {
+        power <<= 1;
+    }
+    return power;
+}
+
+void fft(std::complex<double>* data, size_t n, bool inverse)
+{
+    if (n == 0 || (n & (n - 1)) != 0)
+    {
+        throw std::invalid_argument("The FFT size must be a power of two.");
+    }
+
+    // Reorder the input by bit-reversed index.
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; (j & bit) != 0; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    // Iterative Cooley-Tukey butterflies.
+    const double sign = inverse ? 1.0 : -1.0;
+    for (size_t length = 2; length <= n; length <<= 1)
+    {
+        const double angle = sign * 2.0 * M_PI / static_cast<double>(length);
+        const std::complex<double> step(std::cos(angle), std::sin(angle));
+        for (size_t start = 0; start < n; start += length)
+        {
+            std::complex<double> twiddle(1, 0);
+            for (size_t k = 0; k < length / 2; ++k)
+            {
+                const std::complex<double> even = data[start + k];
+                const std::complex<double> odd = data[start + k + length / 2] * twiddle;
+                data[start + k] = even + odd;
+                data[start + k + length / 2] = even - odd;
+                twiddle *= step;
+            }
+        }
+    }
+
+    if (inverse)
+    {
+        const double scale = 1.0 / static_cast<double>(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            data[i] *= scale;
+        }
+    }
+}
+
+}; }; // end namespace freud::util
@@ -0,0 +1,31 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <cstddef>
+
+/*! \file FFT.h
+    \brief Minimal fast Fourier transform used for time correlation functions.
+*/
+
+namespace freud { namespace util {
+
+//! Get the smallest power of two that is not less than n.
+size_t nextPowerOfTwo(size_t n);
+
+//! Compute an in-place radix-2 fast Fourier transform.
+/*! The forward transform uses the kernel exp(-2 pi i j k / n). The inverse
+ *  transform uses exp(2 pi i j k / n) and includes the 1/n normalization.
+ *
+ *  \param data Data to transform.
+ *  \param n Number of elements, which must be a power of two.
+ *  \param inverse Whether to compute the inverse transform.
+ */
+void fft(std::complex<double>* data, size_t n, bool inverse = false);
+
+}; }; // end namespace freud::util
+
+#endif // FFT_H
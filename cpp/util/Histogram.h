@@ -1,7 +1,10 @@
 #ifndef HISTOGRAM_H
 #define HISTOGRAM_H
 
+#include <array>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 #ifdef __SSE2__
@@ -195,14 +198,18 @@ public:
      * local copies all share the same axes (because the axes are stored as
      * arrays of shared_ptrs in the Histogram class). This should cause no
      * problems, but can be refactored if needed.
+     *
+     * If a tile size is given, the thread local copies use tiled storage (see
+     * the Histogram constructor), so each thread only allocates the bins near
+     * the values it counts.
      */
     class ThreadLocalHistogram
     {
     public:
         ThreadLocalHistogram() = default;
 
-        explicit ThreadLocalHistogram(const Histogram& histogram)
-            : m_local_histograms([histogram]() { return Histogram(histogram.m_axes); })
+        explicit ThreadLocalHistogram(const Histogram& histogram, size_t tile_size = 0)
+            : m_local_histograms([histogram, tile_size]() { return Histogram(histogram.m_axes, tile_size); })
         {}
 
         using const_iterator = typename tbb::enumerable_thread_specific<Histogram<T>>::const_iterator;
@@ -258,12 +265,36 @@ public:
         void reduceInto(ManagedArray<T>& result)
         {
             result.reset();
-            util::forLoopWrapper(0, result.size(), [=, &result](size_t begin, size_t end) {
-                for (size_t i = begin; i < end; ++i)
+            if (m_local_histograms.empty() || m_local_histograms.begin()->m_tile_size == 0)
+            {
+                util::forLoopWrapper(0, result.size(), [=, &result](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        for (auto hist = m_local_histograms.begin(); hist != m_local_histograms.end(); ++hist)
+                        {
+                            result[i] += hist->m_bin_counts[i];
+                        }
+                    }
+                });
+                return;
+            }
+
+            // Only add the tiles that each thread allocated.
+            const size_t tile_size = m_local_histograms.begin()->m_tile_size;
+            const size_t num_tiles = m_local_histograms.begin()->m_tiles.size();
+            util::forLoopWrapper(0, num_tiles, [=, &result](size_t begin, size_t end) {
+                for (size_t tile = begin; tile < end; ++tile)
                 {
+                    // The last tile may extend past the end of the histogram.
+                    const size_t offset = tile * tile_size;
+                    const size_t tile_end = std::min(tile_size, result.size() - offset);
                     for (auto hist = m_local_histograms.begin(); hist != m_local_histograms.end(); ++hist)
                     {
-                        result[i] += hist->m_bin_counts[i];
+                        const std::vector<T>& counts = hist->m_tiles[tile];
+                        for (size_t i = 0; i < std::min(counts.size(), tile_end); ++i)
+                        {
+                            result[offset + i] += counts[i];
+                        }
                     }
                 }
             });
@@ -281,12 +312,29 @@ public:
     Histogram() = default;
 
     //! Constructor
-    explicit Histogram(std::vector<std::shared_ptr<Axis>> axes) : m_axes(std::move(axes))
+    /*! By default the bin counts are stored in a dense array. If tile_size is
+     *  nonzero, the linear bins are instead grouped into tiles of tile_size
+     *  bins that are allocated when a bin in them is first incremented, so
+     *  memory use scales with the occupied bins. Tiled histograms are meant
+     *  for accumulation and are read by reducing them into a dense array.
+     *
+     *  \param axes The axes of the histogram.
+     *  \param tile_size Number of bins per tile, or 0 for dense storage.
+     */
+    explicit Histogram(std::vector<std::shared_ptr<Axis>> axes, size_t tile_size = 0)
+        : m_axes(std::move(axes)), m_tile_size(tile_size)
     {
-        std::vector<size_t> sizes(m_axes.size());
-        std::transform(m_axes.begin(), m_axes.end(), sizes.begin(),
-                       [](const auto& ax) { return ax->size(); });
-        m_bin_counts = ManagedArray<T>(sizes);
+        std::vector<size_t> sizes(getAxisSizes());
+        if (m_tile_size == 0)
+        {
+            m_bin_counts = ManagedArray<T>(sizes);
+        }
+        else
+        {
+            const size_t num_bins
+                = std::accumulate(sizes.begin(), sizes.end(), size_t(1), std::multiplies<>());
+            m_tiles.resize((num_bins + m_tile_size - 1) / m_tile_size);
+        }
     }
 
     //! Simple convenience for 1D arrays that calls through to the shape based `prepare` function.
@@ -314,22 +362,28 @@ public:
     template<typename... FloatsOrWeight> void operator()(FloatsOrWeight... values)
     {
         std::pair<std::vector<float>, Weight<T>> value_vector = getValueVector(values...);
-        size_t value_bin = bin(value_vector.first);
-        // Check for sentinel to avoid overflow.
-        if (value_bin != Axis::OVERFLOW_BIN)
-        {
-            m_bin_counts[value_bin] += value_vector.second.value;
-        }
+        increment(bin(value_vector.first), value_vector.second.value);
     }
 
     //! Increment specified linear bin (with a specified weight if desired).
     void increment(size_t value_bin, T weight = 1)
     {
         // Check for sentinel to avoid overflow.
-        if (value_bin != Axis::OVERFLOW_BIN)
+        if (value_bin == Axis::OVERFLOW_BIN)
+        {
+            return;
+        }
+        if (m_tile_size == 0)
         {
             m_bin_counts[value_bin] += weight;
+            return;
+        }
+        std::vector<T>& tile = m_tiles[value_bin / m_tile_size];
+        if (tile.empty())
+        {
+            tile.resize(m_tile_size);
         }
+        tile[value_bin % m_tile_size] += weight;
     }
 
     //! Find the bin of a value.
@@ -346,8 +400,9 @@ public:
                 << " values were provided in bin" << std::endl;
             throw std::invalid_argument(msg.str());
         }
-        // First bin the values along each axis.
-        std::vector<size_t> ax_bins;
+        // Bin the values along each axis and combine the bins into a linear
+        // index in row-major order.
+        size_t index = 0;
         for (unsigned int ax_idx = 0; ax_idx < m_axes.size(); ++ax_idx)
         {
             size_t bin_i = m_axes[ax_idx]->bin(values[ax_idx]);
@@ -356,10 +411,30 @@ public:
             {
                 return Axis::OVERFLOW_BIN;
             }
-            ax_bins.push_back(bin_i);
+            index = index * m_axes[ax_idx]->size() + bin_i;
         }
+        return index;
+    }
 
-        return m_bin_counts.getIndex(ax_bins);
+    //! Find the bin of a value in a histogram of fixed dimensionality.
+    /*! Unlike bin(std::vector<float>), this does not allocate, so it may be
+     *  used in tight loops. The number of values must match the number of
+     *  axes, which is not checked.
+     */
+    template<size_t D> size_t bin(const std::array<float, D>& values) const
+    {
+        size_t index = 0;
+        for (size_t ax_idx = 0; ax_idx < D; ++ax_idx)
+        {
+            const size_t bin_i = m_axes[ax_idx]->bin(values[ax_idx]);
+            // Immediately return sentinel if any bin is out of bounds.
+            if (bin_i == Axis::OVERFLOW_BIN)
+            {
+                return Axis::OVERFLOW_BIN;
+            }
+            index = index * m_axes[ax_idx]->size() + bin_i;
+        }
+        return index;
     }
 
     //! Get the computed histogram.
@@ -371,13 +446,19 @@ public:
     //! Get the shape of the computed histogram.
     std::vector<size_t> shape() const
     {
-        return m_bin_counts.shape();
+        return getAxisSizes();
     }
 
     //! Reset the histogram.
+    /*! Tiled histograms release all of their tiles.
+     */
     void reset()
     {
         m_bin_counts.reset();
+        for (auto& tile : m_tiles)
+        {
+            std::vector<T>().swap(tile);
+        }
     }
 
     //! Return the edges of bins.
@@ -483,6 +564,8 @@ public:
 protected:
     std::vector<std::shared_ptr<Axis>> m_axes; //!< The axes.
     ManagedArray<T> m_bin_counts;              //!< Counts for each bin
+    size_t m_tile_size {0};                    //!< Number of bins per tile, or 0 for dense storage
+    std::vector<std::vector<T>> m_tiles;       //!< Tiles of bin counts, empty until first incremented
 
     //! The base case for type float when constructing a vector of values provided to operator().
     /*! This function and the accompanying recursive function below employ
@@ -0,0 +1,283 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#include <cmath>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "SphericalHarmonics.h"
+
+/*! \file SphericalHarmonics.cc
+    \brief Batched evaluation of spherical harmonics from Cartesian bond vectors.
+*/
+
+namespace freud { namespace util {
+
+namespace {
+
+// Minimal set of lane-wise operations used by the recurrences. Each batch of
+// bonds occupies exactly one vector register when AVX2 or AVX-512 is enabled.
+#if defined(__AVX512F__)
+using Lanes = __m512;
+
+inline Lanes load(const float* p)
+{
+    return _mm512_loadu_ps(p);
+}
+inline void store(float* p, Lanes a)
+{
+    _mm512_storeu_ps(p, a);
+}
+inline Lanes set1(float v)
+{
+    return _mm512_set1_ps(v);
+}
+inline Lanes mul(Lanes a, Lanes b)
+{
+    return _mm512_mul_ps(a, b);
+}
+//! Computes a * b + c
+inline Lanes fmadd(Lanes a, Lanes b, Lanes c)
+{
+    return _mm512_fmadd_ps(a, b, c);
+}
+//! Computes a * b - c
+inline Lanes fmsub(Lanes a, Lanes b, Lanes c)
+{
+    return _mm512_fmsub_ps(a, b, c);
+}
+#elif defined(__AVX2__)
+using Lanes = __m256;
+
+inline Lanes load(const float* p)
+{
+    return _mm256_loadu_ps(p);
+}
+inline void store(float* p, Lanes a)
+{
+    _mm256_storeu_ps(p, a);
+}
+inline Lanes set1(float v)
+{
+    return _mm256_set1_ps(v);
+}
+inline Lanes mul(Lanes a, Lanes b)
+{
+    return _mm256_mul_ps(a, b);
+}
+inline Lanes fmadd(Lanes a, Lanes b, Lanes c)
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+inline Lanes fmsub(Lanes a, Lanes b, Lanes c)
+{
+#if defined(__FMA__)
+    return _mm256_fmsub_ps(a, b, c);
+#else
+    return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+#else
+// Portable fallback. The fixed trip count lets the compiler vectorize these
+// loops with whatever instruction set is available.
+struct Lanes
+{
+    float v[SphericalHarmonics::batch_size];
+};
+
+inline Lanes load(const float* p)
+{
+    Lanes r;
+    for (unsigned int k = 0; k < SphericalHarmonics::batch_size; ++k)
+    {
+        r.v[k] = p[k];
+    }
+    return r;
+}
+inline void store(float* p, const Lanes& a)
+{
+    for (unsigned int k = 0; k < SphericalHarmonics::batch_size; ++k)
+    {
+        p[k] = a.v[k];
+    }
+}
+inline Lanes set1(float v)
+{
+    Lanes r;
+    for (float& value : r.v)
+    {
+        value = v;
+    }
+    return r;
+}
+inline Lanes mul(const Lanes& a, const Lanes& b)
+{
+    Lanes r;
+    for (unsigned int k = 0; k < SphericalHarmonics::batch_size; ++k)
+    {
+        r.v[k] = a.v[k] * b.v[k];
+    }
+    return r;
+}
+inline Lanes fmadd(const Lanes& a, const Lanes& b, const Lanes& c)
+{
+    Lanes r;
+    for (unsigned int k = 0; k < SphericalHarmonics::batch_size; ++k)
+    {
+        r.v[k] = a.v[k] * b.v[k] + c.v[k];
+    }
+    return r;
+}
+inline Lanes fmsub(const Lanes& a, const Lanes& b, const Lanes& c)
+{
+    Lanes r;
+    for (unsigned int k = 0; k < SphericalHarmonics::batch_size; ++k)
+    {
+        r.v[k] = a.v[k] * b.v[k] - c.v[k];
+    }
+    return r;
+}
+#endif
+
+}; // end anonymous namespace
+
+SphericalHarmonics::SphericalHarmonics(unsigned int l_max)
+    : m_l_max(l_max), m_diagonal(l_max + 1), m_a(count(l_max)), m_ab(count(l_max)),
+      m_real(count(l_max) * batch_size), m_imag(count(l_max) * batch_size),
+      m_sum_real(count(l_max) * batch_size), m_sum_imag(count(l_max) * batch_size),
+      m_reduced(count(l_max))
+{
+    // The normalized P_m^m(cos(theta)) is a constant multiple of sin(theta)^m,
+    // and that power of sin(theta) is carried by (x + iy)^m.
+    double diagonal(std::sqrt(1.0 / (4.0 * M_PI)));
+    for (unsigned int m = 0; m <= l_max; ++m)
+    {
+        if (m > 0)
+        {
+            diagonal *= std::sqrt((2.0 * m + 1.0) / (2.0 * m));
+        }
+        m_diagonal[m] = float(diagonal);
+
+        // P_l^m = a_lm * (z P_{l-1}^m - b_lm P_{l-2}^m) for l > m. With l = m + 1
+        // the second term vanishes and a_lm reduces to sqrt(2m + 3).
+        for (unsigned int l = m + 1; l <= l_max; ++l)
+        {
+            const double l2(double(l) * l);
+            const double m2(double(m) * m);
+            const double a(std::sqrt((4.0 * l2 - 1.0) / (l2 - m2)));
+            const double prev_l2((l - 1.0) * (l - 1.0));
+            const double b(l > m + 1 ? std::sqrt((prev_l2 - m2) / (4.0 * prev_l2 - 1.0)) : 0.0);
+            m_a[index(l, m)] = float(a);
+            m_ab[index(l, m)] = float(a * b);
+        }
+    }
+}
+
+void SphericalHarmonics::compute(const vec3<float>* bonds, unsigned int n)
+{
+    float x[batch_size];
+    float y[batch_size];
+    float z[batch_size];
+    for (unsigned int k = 0; k < batch_size; ++k)
+    {
+        x[k] = 0;
+        y[k] = 0;
+        z[k] = 1;
+        if (k < n)
+        {
+            const float r_sq(dot(bonds[k], bonds[k]));
+            if (r_sq > 0)
+            {
+                const float inv_r(float(1.0) / std::sqrt(r_sq));
+                x[k] = bonds[k].x * inv_r;
+                y[k] = bonds[k].y * inv_r;
+                z[k] = bonds[k].z * inv_r;
+            }
+        }
+    }
+
+    const Lanes vx(load(x));
+    const Lanes vy(load(y));
+    const Lanes vz(load(z));
+
+    // Real and imaginary parts of (x + iy)^m
+    Lanes power_real(set1(1));
+    Lanes power_imag(set1(0));
+
+    for (unsigned int m = 0; m <= m_l_max; ++m)
+    {
+        if (m > 0)
+        {
+            const Lanes next_real(fmsub(power_real, vx, mul(power_imag, vy)));
+            power_imag = fmadd(power_real, vy, mul(power_imag, vx));
+            power_real = next_real;
+        }
+
+        // Legendre recurrence in z, starting from the diagonal term l = m
+        Lanes p_prev(set1(m_diagonal[m]));
+        unsigned int offset(index(m, m) * batch_size);
+        store(&m_real[offset], mul(p_prev, power_real));
+        store(&m_imag[offset], mul(p_prev, power_imag));
+        if (m == m_l_max)
+        {
+            break;
+        }
+
+        Lanes p_curr(mul(set1(m_a[index(m + 1, m)] * m_diagonal[m]), vz));
+        offset = index(m + 1, m) * batch_size;
+        store(&m_real[offset], mul(p_curr, power_real));
+        store(&m_imag[offset], mul(p_curr, power_imag));
+
+        for (unsigned int l = m + 2; l <= m_l_max; ++l)
+        {
+            const unsigned int lm(index(l, m));
+            const Lanes p_next(fmsub(mul(set1(m_a[lm]), vz), p_curr, mul(set1(m_ab[lm]), p_prev)));
+            offset = lm * batch_size;
+            store(&m_real[offset], mul(p_next, power_real));
+            store(&m_imag[offset], mul(p_next, power_imag));
+            p_prev = p_curr;
+            p_curr = p_next;
+        }
+    }
+}
+
+void SphericalHarmonics::accumulate(const float* weights, unsigned int n)
+{
+    float padded_weights[batch_size];
+    for (unsigned int k = 0; k < batch_size; ++k)
+    {
+        padded_weights[k] = k < n ? weights[k] : float(0);
+    }
+    const Lanes w(load(padded_weights));
+
+    for (size_t offset = 0; offset < m_real.size(); offset += batch_size)
+    {
+        store(&m_sum_real[offset], fmadd(w, load(&m_real[offset]), load(&m_sum_real[offset])));
+        store(&m_sum_imag[offset], fmadd(w, load(&m_imag[offset]), load(&m_sum_imag[offset])));
+    }
+}
+
+const std::vector<std::complex<float>>& SphericalHarmonics::reduce()
+{
+    for (size_t i = 0; i < m_reduced.size(); ++i)
+    {
+        float sum_real(0);
+        float sum_imag(0);
+        for (unsigned int k = 0; k < batch_size; ++k)
+        {
+            sum_real += m_sum_real[i * batch_size + k];
+            sum_imag += m_sum_imag[i * batch_size + k];
+            m_sum_real[i * batch_size + k] = 0;
+            m_sum_imag[i * batch_size + k] = 0;
+        }
+        m_reduced[i] = {sum_real, sum_imag};
+    }
+    return m_reduced;
+}
+
+}; }; // end namespace freud::util
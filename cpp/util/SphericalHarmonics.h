@@ -0,0 +1,109 @@
+// Copyright (c) 2010-2020 The Regents of the University of Michigan
+// This file is from the freud project, released under the BSD 3-Clause License.
+
+#ifndef SPHERICAL_HARMONICS_H
+#define SPHERICAL_HARMONICS_H
+
+#include <complex>
+#include <vector>
+
+#include "VectorMath.h"
+
+/*! \file SphericalHarmonics.h
+    \brief Batched evaluation of spherical harmonics from Cartesian bond vectors.
+*/
+
+//! Number of bonds evaluated per call, matching the widest enabled vector unit.
+#if defined(__AVX512F__)
+#define FREUD_SPH_BATCH_SIZE 16
+#else
+#define FREUD_SPH_BATCH_SIZE 8
+#endif
+
+namespace freud { namespace util {
+
+//! Evaluate spherical harmonics Y_l^m for batches of bonds.
+/*! Harmonics are computed directly from the Cartesian components of the unit
+ *  bond vector (x, y, z), avoiding all trigonometric functions. The azimuthal
+ *  part is generated as successive powers of (x + iy) = sin(theta) e^{i phi},
+ *  and the polar part by the normalized associated Legendre recurrence in z
+ *  with the sin(theta)^m factor removed. A batch of bonds is stored in
+ *  structure-of-arrays form so that each step of the recurrences is a single
+ *  AVX-512 (16 bonds) or AVX2 (8 bonds) instruction when those instruction
+ *  sets are enabled at compile time, with a portable fallback otherwise.
+ *
+ *  Only m >= 0 is evaluated, without the Condon-Shortley phase. Values for
+ *  negative m follow from \f$ Y_l^{-m} = \overline{Y_l^m} \f$. Harmonics are
+ *  ordered by l, then m, as given by index(l, m).
+ *
+ *  Instances hold per-batch scratch space, so each thread should use its own.
+ */
+class SphericalHarmonics
+{
+public:
+    //! Number of bonds evaluated by a single call to compute.
+    static constexpr unsigned int batch_size = FREUD_SPH_BATCH_SIZE;
+
+    //! Constructor
+    /*! \param l_max Maximum spherical harmonic l to evaluate.
+     */
+    explicit SphericalHarmonics(unsigned int l_max);
+
+    //! Get the maximum spherical harmonic l.
+    unsigned int getLMax() const
+    {
+        return m_l_max;
+    }
+
+    //! Number of harmonics with m >= 0 for all l <= l_max.
+    static unsigned int count(unsigned int l_max)
+    {
+        return (l_max + 1) * (l_max + 2) / 2;
+    }
+
+    //! Position of Y_l^m (m >= 0) in the ordering of harmonics.
+    static unsigned int index(unsigned int l, unsigned int m)
+    {
+        return l * (l + 1) / 2 + m;
+    }
+
+    //! Evaluate the harmonics of up to batch_size bonds.
+    /*! Bonds need not be normalized. Bonds of zero length are treated as
+     *  pointing along +z.
+     *
+     *  \param bonds Bond vectors.
+     *  \param n Number of bonds, at most batch_size.
+     */
+    void compute(const vec3<float>* bonds, unsigned int n);
+
+    //! Get Y_l^m (m >= 0) of a bond from the last call to compute.
+    std::complex<float> get(unsigned int bond, unsigned int l, unsigned int m) const
+    {
+        const unsigned int i(index(l, m) * batch_size + bond);
+        return {m_real[i], m_imag[i]};
+    }
+
+    //! Add the weighted harmonics of the last computed batch to the running sums.
+    /*! \param weights Weight of each bond.
+     *  \param n Number of bonds in the batch, at most batch_size.
+     */
+    void accumulate(const float* weights, unsigned int n);
+
+    //! Get the sums of all accumulated harmonics, ordered by index(l, m), and reset them.
+    const std::vector<std::complex<float>>& reduce();
+
+private:
+    unsigned int m_l_max;                       //!< Maximum spherical harmonic l
+    std::vector<float> m_diagonal;              //!< Normalized P_m^m / sin(theta)^m for each m
+    std::vector<float> m_a;                     //!< Recurrence coefficient a_lm, ordered by index(l, m)
+    std::vector<float> m_ab;                    //!< Recurrence coefficient a_lm * b_lm
+    std::vector<float> m_real;                  //!< Real parts of the last batch, per harmonic and bond
+    std::vector<float> m_imag;                  //!< Imaginary parts of the last batch
+    std::vector<float> m_sum_real;              //!< Accumulated real parts, per harmonic and bond
+    std::vector<float> m_sum_imag;              //!< Accumulated imaginary parts
+    std::vector<std::complex<float>> m_reduced; //!< Sums over bonds returned by reduce
+};
+
+}; }; // end namespace freud::util
+
+#endif // SPHERICAL_HARMONICS_H
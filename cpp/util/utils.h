@@ -3,9 +3,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <tbb/blocked_range.h>
 #include <tbb/blocked_range2d.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_scan.h>
 
 namespace freud { namespace util {
 
@@ -26,6 +28,40 @@ template<class Scalar> inline Scalar modulusPositive(Scalar a, Scalar b)
     return std::fmod(std::fmod(a, b) + b, b);
 }
 
+//! Angle of the vector (x, y) in the range [0, 2*pi), without calling atan2.
+/*! The vector is reduced to the first octant by the signs and relative
+    magnitudes of its components, and the arctangent in the octant is further
+    reduced to [0, tan(pi/8)] and evaluated with the polynomial of the Cephes
+    atanf, which is accurate to a few ulp. The branches only select values, so
+    the function can be inlined into vectorized loops.
+
+    \param y The y component.
+    \param x The x component.
+    \returns The angle in [0, 2*pi), or 0 if x = y = 0.
+*/
+inline float angle2D(float y, float x)
+{
+    constexpr float pi = 3.14159265358979323846f;
+    constexpr float tan_pi_8 = 0.41421356237309504880f;
+    const float ax = std::abs(x);
+    const float ay = std::abs(y);
+    const float hi = std::max(ax, ay);
+    const float lo = std::min(ax, ay);
+    const float t = (hi > 0) ? lo / hi : 0;
+    const bool shift = t > tan_pi_8;
+    const float z = shift ? (t - 1) / (t + 1) : t;
+    const float z2 = z * z;
+    float a = (((0.0805374449538f * z2 - 0.138776856032f) * z2 + 0.199777106478f) * z2 - 0.333329491539f)
+            * z2 * z
+        + z;
+    a = shift ? a + pi / 4 : a;
+    a = (ay > ax) ? pi / 2 - a : a;
+    a = (x < 0) ? pi - a : a;
+    a = (y < 0) ? 2 * pi - a : a;
+    // Rounding can map angles just below 2*pi onto 2*pi.
+    return (a < 2 * pi) ? a : 0;
+}
+
 //! Wrapper for for-loop to allow the execution in parallel or not.
 /*! \param begin Beginning index.
  *  \param end Ending index.
@@ -71,6 +107,30 @@ inline void forLoopWrapper2D(size_t begin_row, size_t end_row, size_t begin_col,
     }
 }
 
+//! Compute the inclusive prefix sums of values in parallel.
+/*! \param n Number of values.
+ *  \param value Callable returning the value at an index.
+ *  \param out Output array of length n.
+ *  \return The sum of all values.
+ */
+template<typename Value> inline unsigned int inclusiveScan(size_t n, const Value& value, unsigned int* out)
+{
+    return tbb::parallel_scan(
+        tbb::blocked_range<size_t>(0, n), 0u,
+        [&](const tbb::blocked_range<size_t>& r, unsigned int sum, bool is_final_scan) {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                sum += value(k);
+                if (is_final_scan)
+                {
+                    out[k] = sum;
+                }
+            }
+            return sum;
+        },
+        std::plus<unsigned int>());
+}
+
 }; }; // namespace freud::util
 
 #endif
@@ -15,13 +15,34 @@ cdef extern from "Cluster.h" namespace "freud::cluster":
                      const unsigned int*) except +
         unsigned int getNumClusters() const
         const freud.util.ManagedArray[unsigned int] &getClusterIdx() const
-        const vector[vector[uint]] getClusterKeys() const
+        const freud.util.ManagedArray[unsigned int] &getClusterKeys() const
+        const freud.util.ManagedArray[unsigned int] &getClusterKeyOffsets() \
+            const
 
 cdef extern from "ClusterProperties.h" namespace "freud::cluster":
     cdef cppclass ClusterProperties:
         ClusterProperties()
         void compute(const freud._locality.NeighborQuery*,
-                     const unsigned int*) except +
+                     const unsigned int*,
+                     const float*) except +
         const freud.util.ManagedArray[vec3[float]] &getClusterCenters() const
         const freud.util.ManagedArray[float] &getClusterGyrations() const
+        const freud.util.ManagedArray[float] &getClusterInertiaTensors() const
+        const freud.util.ManagedArray[float] &getClusterRadiiOfGyration() const
+        const freud.util.ManagedArray[float] &getClusterPrincipalMoments() \
+            const
+        const freud.util.ManagedArray[vec3[float]] \
+            &getClusterBoundingBoxes() const
         const freud.util.ManagedArray[unsigned int] &getClusterSizes() const
+        const freud.util.ManagedArray[float] &getClusterMasses() const
+
+cdef extern from "ClusterTracker.h" namespace "freud::cluster":
+    cdef cppclass ClusterTracker:
+        ClusterTracker()
+        void compute(const unsigned int*, unsigned int) except +
+        void reset()
+        unsigned int getNumFrames() const
+        const freud.util.ManagedArray[unsigned int] &getClusterIds() const
+        const freud.util.ManagedArray[unsigned int] &getOverlaps() const
+        const freud.util.ManagedArray[unsigned int] &getSplits() const
+        const freud.util.ManagedArray[unsigned int] &getMerges() const
@@ -19,6 +19,12 @@ cdef extern from "CorrelationFunction.h" namespace "freud::density":
                         const T*,
                         unsigned int, const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
+        void accumulateTrajectory(const freud._box.Box*,
+                                  const vec3[float]*,
+                                  const T*,
+                                  unsigned int,
+                                  unsigned int,
+                                  freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[T] &getCorrelation()
 
 cdef extern from "GaussianDensity.h" namespace "freud::density":
@@ -56,6 +62,11 @@ cdef extern from "RDF.h" namespace "freud::density":
                         unsigned int,
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
+        void accumulateTrajectory(const freud._box.Box*,
+                                  const vec3[float]*,
+                                  unsigned int,
+                                  unsigned int,
+                                  freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[float] &getRDF()
         const freud.util.ManagedArray[float] &getNr()
 
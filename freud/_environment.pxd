@@ -23,12 +23,19 @@ cdef extern from "BondOrder.h" namespace "freud::environment":
         BondOrder(unsigned int, unsigned int, BondOrderMode) except +
         void accumulate(
             const freud._locality.NeighborQuery*,
-            quat[float]*,
-            vec3[float]*,
-            quat[float]*,
+            const quat[float]*,
+            const vec3[float]*,
+            const quat[float]*,
             unsigned int,
             const freud._locality.NeighborList*,
             freud._locality.QueryArgs) except +
+        void accumulateTrajectory(
+            const freud._box.Box*,
+            const vec3[float]*,
+            const quat[float]*,
+            unsigned int,
+            unsigned int,
+            freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[float] &getBondOrder()
         BondOrderMode getMode() const
 
@@ -38,9 +45,14 @@ cdef extern from "LocalDescriptors.h" namespace "freud::environment":
         Global
         ParticleLocal
 
+    ctypedef enum LocalDescriptorOutput:
+        BondHarmonics
+        PowerSpectrum
+
     cdef cppclass LocalDescriptors:
         LocalDescriptors(unsigned int,
-                         bool, LocalDescriptorOrientation)
+                         bool, LocalDescriptorOrientation,
+                         LocalDescriptorOutput)
         unsigned int getNSphs() const
         unsigned int getLMax() const
         unsigned int getSphWidth() const
@@ -52,8 +64,10 @@ cdef extern from "LocalDescriptors.h" namespace "freud::environment":
             freud._locality.QueryArgs,
             unsigned int) except +
         const freud.util.ManagedArray[float complex] &getSph() const
+        const freud.util.ManagedArray[float] &getPowerSpectrum() const
         freud._locality.NeighborList * getNList()
         LocalDescriptorOrientation getMode() const
+        LocalDescriptorOutput getOutput() const
         bool getNegativeM() const
 
 cdef extern from "MatchEnv.h" namespace "freud::environment":
@@ -119,6 +119,8 @@ cdef extern from "BondHistogramCompute.h" namespace "freud::locality":
         vector[vector[float]] getBinCenters() const
         vector[pair[float, float]] getBounds() const
         vector[size_t] getAxisSizes() const
+        void setTileSize(size_t)
+        size_t getTileSize() const
 
 cdef extern from "PeriodicBuffer.h" namespace "freud::locality":
     cdef cppclass PeriodicBuffer:
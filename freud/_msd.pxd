@@ -0,0 +1,20 @@
+# Copyright (c) 2010-2020 The Regents of the University of Michigan
+# This file is from the freud project, released under the BSD 3-Clause License.
+
+from freud.util cimport vec3
+
+cimport freud._box
+cimport freud.util
+
+cdef extern from "MSD.h" namespace "freud::msd":
+    ctypedef enum MSDMode:
+        Window
+        Direct
+
+    cdef cppclass MSD:
+        MSD(MSDMode) except +
+        void compute(const vec3[float]*, const vec3[int]*,
+                     const freud._box.Box &, unsigned int,
+                     unsigned int) except +
+        const freud.util.ManagedArray[double] &getParticleMSD() const
+        MSDMode getMode() const
@@ -11,15 +11,22 @@ cimport freud._locality
 cimport freud.util
 
 cdef extern from "Cubatic.h" namespace "freud::order":
+    ctypedef enum CubaticOptimizer:
+        SimulatedAnnealing
+        GradientAscent
+
     cdef cppclass Cubatic:
         Cubatic(float,
                 float,
                 float,
                 unsigned int,
-                unsigned int) except +
+                unsigned int,
+                CubaticOptimizer) except +
         void reset()
         void compute(quat[float]*,
-                     unsigned int) except +
+                     unsigned int,
+                     bool) except +
+        void computeParticleOrderParameter(const quat[float]*) except +
         unsigned int getNumParticles() const
         float getCubaticOrderParameter() const
         const freud.util.ManagedArray[float] &getParticleOrderParameter() const
@@ -31,6 +38,7 @@ cdef extern from "Cubatic.h" namespace "freud::order":
         float getScale() const
         unsigned int getNReplicates() const
         unsigned int getSeed() const
+        CubaticOptimizer getOptimizer() const
 
 
 cdef extern from "Nematic.h" namespace "freud::order":
@@ -38,7 +46,9 @@ cdef extern from "Nematic.h" namespace "freud::order":
         Nematic(vec3[float])
         void reset()
         void compute(quat[float]*,
-                     unsigned int) except +
+                     unsigned int,
+                     bool) except +
+        void computeParticleTensor(const quat[float]*) except +
         unsigned int getNumParticles() const
         float getNematicOrderParameter() const
         const freud.util.ManagedArray[float] &getParticleTensor() const
@@ -49,12 +59,12 @@ cdef extern from "Nematic.h" namespace "freud::order":
 
 cdef extern from "HexaticTranslational.h" namespace "freud::order":
     cdef cppclass Hexatic:
-        Hexatic(unsigned int, bool)
+        Hexatic(vector[unsigned int], bool) except +
         void compute(const freud._locality.NeighborList*,
                      const freud._locality.NeighborQuery*,
                      freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[float complex] &getOrder()
-        unsigned int getK()
+        vector[unsigned int] getK()
         bool isWeighted() const
 
     cdef cppclass Translational:
@@ -69,19 +79,20 @@ cdef extern from "HexaticTranslational.h" namespace "freud::order":
 
 cdef extern from "Steinhardt.h" namespace "freud::order":
     cdef cppclass Steinhardt:
-        Steinhardt(unsigned int, bool, bool, bool, bool) except +
+        Steinhardt(vector[unsigned int], bool, bool, bool, bool) except +
         unsigned int getNP() const
         void compute(const freud._locality.NeighborList*,
                      const freud._locality.NeighborQuery*,
                      freud._locality.QueryArgs) except +
         const freud.util.ManagedArray[float] &getQl() const
+        const vector[freud.util.ManagedArray[float complex]] &getQlm() const
         const freud.util.ManagedArray[float] &getParticleOrder() const
-        float getOrder() const
+        const freud.util.ManagedArray[float] &getOrder() const
         bool isAverage() const
         bool isWl() const
         bool isWeighted() const
         bool isWlNormalized() const
-        unsigned int getL() const
+        const vector[unsigned int] &getL() const
 
 
 cdef extern from "SolidLiquid.h" namespace "freud::order":
@@ -102,6 +113,9 @@ cdef extern from "SolidLiquid.h" namespace "freud::order":
         unsigned int getNumClusters() const
         freud._locality.NeighborList * getNList()
         const freud.util.ManagedArray[float] &getQlij() const
+        vector[unsigned int] sweepThresholds(
+            const vector[float] &,
+            const vector[unsigned int] &) except +
 
 
 cdef extern from "RotationalAutocorrelation.h" namespace "freud::order":
@@ -111,4 +125,7 @@ cdef extern from "RotationalAutocorrelation.h" namespace "freud::order":
         unsigned int getL() const
         const freud.util.ManagedArray[float complex] &getRAArray() const
         float getRotationalAutocorrelation() const
+        const freud.util.ManagedArray[float] &getLagAutocorrelation() const
         void compute(quat[float]*, quat[float]*, unsigned int) except +
+        void computeTrajectory(const quat[float]*, unsigned int,
+                               unsigned int) except +
@@ -4,6 +4,7 @@
 from freud.util cimport vec3, quat
 from freud._locality cimport BondHistogramCompute
 
+cimport freud._box
 cimport freud._locality
 cimport freud.util
 
@@ -24,6 +25,13 @@ cdef extern from "PMFTR12.h" namespace "freud::pmft":
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
 
+        void accumulateTrajectory(const freud._box.Box*,
+                                  const vec3[float]*,
+                                  const float*,
+                                  unsigned int,
+                                  unsigned int,
+                                  freud._locality.QueryArgs) except +
+
 cdef extern from "PMFTXYT.h" namespace "freud::pmft":
     cdef cppclass PMFTXYT(PMFT):
         PMFTXYT(float, float,
@@ -37,6 +45,13 @@ cdef extern from "PMFTXYT.h" namespace "freud::pmft":
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
 
+        void accumulateTrajectory(const freud._box.Box*,
+                                  const vec3[float]*,
+                                  const float*,
+                                  unsigned int,
+                                  unsigned int,
+                                  freud._locality.QueryArgs) except +
+
 cdef extern from "PMFTXY.h" namespace "freud::pmft":
     cdef cppclass PMFTXY(PMFT):
         PMFTXY(float, float, unsigned int, unsigned int) except +
@@ -48,6 +63,13 @@ cdef extern from "PMFTXY.h" namespace "freud::pmft":
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
 
+        void accumulateTrajectory(const freud._box.Box*,
+                                  const vec3[float]*,
+                                  const float*,
+                                  unsigned int,
+                                  unsigned int,
+                                  freud._locality.QueryArgs) except +
+
 cdef extern from "PMFTXYZ.h" namespace "freud::pmft":
     cdef cppclass PMFTXYZ(PMFT):
         PMFTXYZ(float, float, float, unsigned int, unsigned int,
@@ -61,3 +83,12 @@ cdef extern from "PMFTXYZ.h" namespace "freud::pmft":
                         unsigned int,
                         const freud._locality.NeighborList*,
                         freud._locality.QueryArgs) except +
+
+        void accumulateTrajectory(const freud._box.Box*,
+                                  const vec3[float]*,
+                                  const quat[float]*,
+                                  unsigned int,
+                                  unsigned int,
+                                  const quat[float]*,
+                                  unsigned int,
+                                  freud._locality.QueryArgs) except +
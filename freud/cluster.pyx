@@ -43,9 +43,12 @@ cdef class Cluster(_PairCompute):
     the :code:`cluster_idx` array. Given a key value per point (e.g. the
     polymer id), the compute function will process clusters with the key values
     in mind and provide a list of keys that are present in each cluster in the
-    attribute :code:`cluster_keys`, as a list of lists. If keys are not
-    provided, every point is assigned a key corresponding to its index, and
-    :code:`cluster_keys` contains the point ids present in each cluster.
+    attribute :code:`cluster_keys`, as a list of lists. The same keys are
+    available without copying as a flat array, :code:`flat_cluster_keys`,
+    with the start of each cluster given by :code:`cluster_key_offsets`. If
+    keys are not provided, every point is assigned a key corresponding to its
+    index, and :code:`cluster_keys` contains the point ids present in each
+    cluster.
     """
 
     cdef freud._cluster.Cluster * thisptr
@@ -116,8 +119,30 @@ cdef class Cluster(_PairCompute):
     def cluster_keys(self):
         """list(list): A list of lists of the keys contained in each
         cluster."""
-        cluster_keys = self.thisptr.getClusterKeys()
-        return cluster_keys
+        keys = self.flat_cluster_keys
+        offsets = self.cluster_key_offsets
+        return [keys[offsets[i]:offsets[i+1]].tolist()
+                for i in range(len(offsets) - 1)]
+
+    @_Compute._computed_property
+    def flat_cluster_keys(self):
+        """(:math:`N_{points}`) :class:`numpy.ndarray`: The keys contained in
+        each cluster, stored contiguously by cluster. The keys of cluster
+        :code:`i` are
+        :code:`flat_cluster_keys[cluster_key_offsets[i]:cluster_key_offsets[i+1]]`.
+        """  # noqa: E501
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterKeys(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
+    @_Compute._computed_property
+    def cluster_key_offsets(self):
+        """(:math:`N_{clusters} + 1`) :class:`numpy.ndarray`: The offset of
+        the first key of each cluster in :code:`flat_cluster_keys`, followed
+        by the total number of keys."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterKeyOffsets(),
+            freud.util.arr_type_t.UNSIGNED_INT)
 
     def __repr__(self):
         return "freud.cluster.{cls}()".format(cls=type(self).__name__)
@@ -156,13 +181,16 @@ cdef class ClusterProperties(_Compute):
     source), this class determines the following properties for each cluster:
 
      - Center of mass
-     - Gyration tensor
-     - Size (number of points)
+     - Gyration tensor, radius of gyration, and principal moments
+     - Inertia tensor
+     - Bounding box
+     - Size (number of points) and total mass
 
     The center of mass for each cluster (properly handling periodic boundary
     conditions) can be accessed with :code:`centers` attribute.  The :math:`3
     \times 3` symmetric gyration tensors :math:`G` can be accessed with
-    :code:`gyrations` attribute.
+    :code:`gyrations` attribute. If masses are provided, the center of mass
+    and all moments are weighted by the mass of each point.
     """
 
     cdef freud._cluster.ClusterProperties * thisptr
@@ -176,7 +204,7 @@ cdef class ClusterProperties(_Compute):
     def __dealloc__(self):
         del self.thisptr
 
-    def compute(self, system, cluster_idx):
+    def compute(self, system, cluster_idx, masses=None):
         R"""Compute properties of the point clusters.
         Loops over all points in the given array and determines the center of
         mass of the cluster as well as the gyration tensor. After calling
@@ -202,15 +230,27 @@ cdef class ClusterProperties(_Compute):
                 :class:`freud.locality.NeighborQuery.from_system`.
             cluster_idx ((:math:`N_{points}`,) :class:`np.ndarray`):
                 Cluster indexes for each point.
+            masses ((:math:`N_{points}`,) :class:`np.ndarray`, optional):
+                Mass of each point. If :code:`None`, every point has unit
+                mass (Default value = :code:`None`).
         """
         cdef freud.locality.NeighborQuery nq = \
             freud.locality.NeighborQuery.from_system(system)
         cluster_idx = freud.util._convert_array(
             cluster_idx, shape=(nq.points.shape[0], ), dtype=np.uint32)
         cdef const unsigned int[::1] l_cluster_idx = cluster_idx
+
+        cdef const float* l_masses_ptr = NULL
+        cdef const float[::1] l_masses
+        if masses is not None:
+            l_masses = freud.util._convert_array(
+                masses, shape=(nq.points.shape[0], ))
+            l_masses_ptr = &l_masses[0]
+
         self.thisptr.compute(
             nq.get_ptr(),
-            <unsigned int*> &l_cluster_idx[0])
+            <unsigned int*> &l_cluster_idx[0],
+            l_masses_ptr)
         return self
 
     @_Compute._computed_property
@@ -233,7 +273,35 @@ cdef class ClusterProperties(_Compute):
     def radii_of_gyration(self):
         """(:math:`N_{clusters}`,) :class:`numpy.ndarray`: The radius of
         gyration of each cluster."""
-        return np.sqrt(np.trace(self.gyrations, axis1=-2, axis2=-1))
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterRadiiOfGyration(),
+            freud.util.arr_type_t.FLOAT)
+
+    @_Compute._computed_property
+    def principal_moments(self):
+        """(:math:`N_{clusters}`, 3) :class:`numpy.ndarray`: The eigenvalues
+        of the gyration tensor of each cluster, in increasing order."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterPrincipalMoments(),
+            freud.util.arr_type_t.FLOAT)
+
+    @_Compute._computed_property
+    def inertia_tensors(self):
+        """(:math:`N_{clusters}`, 3, 3) :class:`numpy.ndarray`: The moment of
+        inertia tensors of the clusters about their centers of mass."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterInertiaTensors(),
+            freud.util.arr_type_t.FLOAT)
+
+    @_Compute._computed_property
+    def bounding_boxes(self):
+        """(:math:`N_{clusters}`, 2, 3) :class:`numpy.ndarray`: The lower and
+        upper corners of the axis-aligned bounding box of each cluster. The
+        corners are measured from the center of mass through the periodic
+        boundaries, so they may lie outside of the box."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterBoundingBoxes(),
+            freud.util.arr_type_t.FLOAT, 3)
 
     @_Compute._computed_property
     def sizes(self):
@@ -242,5 +310,129 @@ cdef class ClusterProperties(_Compute):
             &self.thisptr.getClusterSizes(),
             freud.util.arr_type_t.UNSIGNED_INT)
 
+    @_Compute._computed_property
+    def masses(self):
+        """(:math:`N_{clusters}`) :class:`numpy.ndarray`: The total mass of
+        each cluster, equal to the sizes if no masses were provided."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterMasses(),
+            freud.util.arr_type_t.FLOAT)
+
+    def __repr__(self):
+        return "freud.cluster.{cls}()".format(cls=type(self).__name__)
+
+
+cdef class ClusterTracker(_Compute):
+    R"""Tracks the identity of clusters from frame to frame.
+
+    Given the cluster indices of the points in consecutive frames (from
+    :class:`~.Cluster` or another source), this class assigns each cluster a
+    persistent id. Points must keep their index between frames.
+
+    Each call to :meth:`compute` counts the points shared by every pair of
+    clusters in the previous and current frames. A current cluster keeps the
+    id of a previous cluster if each is the other's largest overlap, with ties
+    broken by the smaller cluster index, and all other clusters receive new
+    ids. A previous cluster overlapping several current clusters is reported
+    in :code:`splits`, and a current cluster overlapping several previous
+    clusters is reported in :code:`merges`.
+
+    Only the previous frame is kept between calls, so the memory used does
+    not grow with the number of frames.
+    """
+
+    cdef freud._cluster.ClusterTracker * thisptr
+
+    def __cinit__(self):
+        self.thisptr = new freud._cluster.ClusterTracker()
+
+    def __init__(self):
+        pass
+
+    def __dealloc__(self):
+        del self.thisptr
+
+    def compute(self, cluster_idx):
+        R"""Match the clusters of a new frame to those of the previous frame.
+
+        Example::
+
+            >>> import freud
+            >>> box, points = freud.data.make_random_system(10, 100, seed=0)
+            >>> cl = freud.cluster.Cluster()
+            >>> tracker = freud.cluster.ClusterTracker()
+            >>> # Assign ids to the clusters of the first frame
+            >>> cl.compute((box, points), neighbors={'r_max': 1.0})
+            freud.cluster.Cluster()
+            >>> tracker.compute(cl.cluster_idx)
+            freud.cluster.ClusterTracker()
+            >>> # Match the clusters of the next frame to the first frame
+            >>> points = box.wrap(points + 0.1)
+            >>> cl.compute((box, points), neighbors={'r_max': 1.0})
+            freud.cluster.Cluster()
+            >>> tracker.compute(cl.cluster_idx)
+            freud.cluster.ClusterTracker()
+
+        Args:
+            cluster_idx ((:math:`N_{points}`,) :class:`np.ndarray`):
+                Cluster indexes for each point.
+        """
+        cluster_idx = freud.util._convert_array(
+            cluster_idx, shape=(None, ), dtype=np.uint32)
+        cdef const unsigned int[::1] l_cluster_idx = cluster_idx
+        cdef unsigned int num_points = l_cluster_idx.shape[0]
+        cdef const unsigned int* l_cluster_idx_ptr = NULL
+        if num_points > 0:
+            l_cluster_idx_ptr = &l_cluster_idx[0]
+        self.thisptr.compute(l_cluster_idx_ptr, num_points)
+        return self
+
+    def reset(self):
+        R"""Forget the previous frame, so that the next frame assigns new ids
+        starting from zero."""
+        self.thisptr.reset()
+
+    @property
+    def num_frames(self):
+        """int: The number of frames computed since the last reset."""
+        return self.thisptr.getNumFrames()
+
+    @_Compute._computed_property
+    def cluster_ids(self):
+        """(:math:`N_{clusters}`,) :class:`numpy.ndarray`: The persistent id
+        of each cluster in the last frame."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getClusterIds(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
+    @_Compute._computed_property
+    def overlaps(self):
+        """(:math:`N_{overlaps}`, 3) :class:`numpy.ndarray`: The sparse
+        overlap matrix between the clusters of the last two frames. Each row
+        holds a cluster index in the previous frame, a cluster index in the
+        current frame, and the number of points they share."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getOverlaps(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
+    @_Compute._computed_property
+    def splits(self):
+        """(:math:`N_{splits}`, 2) :class:`numpy.ndarray`: The split events
+        of the last frame. Each row holds the id of a previous cluster that
+        split and the id of one of the current clusters it overlaps."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getSplits(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
+    @_Compute._computed_property
+    def merges(self):
+        """(:math:`N_{merges}`, 2) :class:`numpy.ndarray`: The merge events
+        of the last frame. Each row holds the id of one of the previous
+        clusters that merged and the id of the current cluster they
+        overlap."""
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getMerges(),
+            freud.util.arr_type_t.UNSIGNED_INT)
+
     def __repr__(self):
         return "freud.cluster.{cls}()".format(cls=type(self).__name__)
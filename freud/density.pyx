@@ -142,6 +142,39 @@ cdef class CorrelationFunction(_SpatialHistogram1D):
             dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, values, neighbors=None,
+                           reset=True):
+        R"""Calculates the correlation function of all frames of a trajectory
+        and adds to the current histogram.
+
+        The remaining arguments are as in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Args:
+            values ((:math:`N_{frames}`, :math:`N_{points}`) :class:`numpy.ndarray`):
+                Values associated with the points of each frame.
+        """  # noqa E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        values = freud.util._convert_array(
+            values, shape=(n_frames, num_points), dtype=np.complex128)
+        cdef np.complex128_t[:, ::1] l_values = values
+
+        if reset:
+            self.is_complex = False
+            self._reset()
+        # Save if any inputs have been complex so far.
+        self.is_complex = self.is_complex or np.any(np.iscomplex(values))
+        self.thisptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            <np.complex128_t*> &l_values[0, 0],
+            n_frames, num_points, dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     @_Compute._computed_property
     def correlation(self):
         """(:math:`N_{bins}`) :class:`numpy.ndarray`: Expected (average)
@@ -665,6 +698,43 @@ cdef class RDF(_SpatialHistogram1D):
             dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, neighbors=None, reset=True):
+        R"""Calculates the RDF of all frames of a trajectory and adds to the
+        current RDF histogram.
+
+        This is equivalent to calling :meth:`compute` with
+        :code:`reset=False` for each frame, using the points of each frame as
+        the query points, but the frames are processed in parallel in a
+        single call.
+
+        Args:
+            boxes (:class:`freud.box.Box` or sequence of box-like objects):
+                The box of all frames, or a box for each frame. The box of the
+                last frame is used for normalization.
+            points ((:math:`N_{frames}`, :math:`N_{points}`, 3) :class:`numpy.ndarray`):
+                Points for each frame of the trajectory.
+            neighbors (dict, optional):
+                A dictionary of `query arguments
+                <https://freud.readthedocs.io/en/stable/topics/querying.html>`_
+                used to find the bonds of each frame (Default value: None).
+            reset (bool):
+                Whether to erase the previously computed values before adding
+                the trajectory; if False, will accumulate data (Default
+                value: True).
+        """  # noqa E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        if reset:
+            self._reset()
+        self.thisptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            n_frames, num_points, dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     @_Compute._computed_property
     def rdf(self):
         """(:math:`N_{bins}`,) :class:`numpy.ndarray`: Histogram of RDF
@@ -197,6 +197,40 @@ cdef class BondOrder(_SpatialHistogram):
             nlist.get_ptr(), dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, orientations=None,
+                           neighbors=None, reset=True):
+        R"""Calculates the bond order diagram of all frames of a trajectory
+        and adds to the current histogram.
+
+        The remaining arguments are as in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Args:
+            orientations ((:math:`N_{frames}`, :math:`N_{points}`, 4) :class:`numpy.ndarray`):
+                Orientations associated with the points of each frame. Uses
+                identity quaternions if :code:`None` (Default value =
+                :code:`None`).
+        """  # noqa: E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        if orientations is None:
+            orientations = np.tile([1, 0, 0, 0], (n_frames, num_points, 1))
+        orientations = freud.util._convert_array(
+            orientations, shape=(n_frames, num_points, 4))
+        cdef const float[:, :, ::1] l_orientations = orientations
+
+        if reset:
+            self._reset()
+        self.thisptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            <quat[float]*> &l_orientations[0, 0, 0],
+            n_frames, num_points, dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     @_Compute._computed_property
     def bond_order(self):
         """:math:`\\left(N_{\\phi}, N_{\\theta} \\right)` :class:`numpy.ndarray`: Bond order."""  # noqa: E501
@@ -240,6 +274,17 @@ cdef class LocalDescriptors(_PairCompute):
     with different values of :code:`max_num_neighbors` to compute descriptors
     for different local neighborhoods with maximum efficiency.
 
+    When only rotationally invariant descriptors are needed, setting
+    :code:`output='power_spectrum'` sums the spherical harmonics of the bonds
+    of each query point and stores only their power spectrum
+
+    .. math::
+
+        p_l = \sum_{m=-l}^{l} \left| \sum_{bonds} Y_l^m \right|^2
+
+    as an array of shape :code:`(N_query_points, l_max + 1)`, without storing
+    the harmonics of each bond.
+
     Args:
         l_max (unsigned int):
             Maximum spherical harmonic :math:`l` to consider.
@@ -252,6 +297,12 @@ cdef class LocalDescriptors(_PairCompute):
             neighborhood, :code:`'particle_local'` to use the given
             particle orientations, or :code:`'global'` to not rotate
             environments (Default value = :code:`'neighborhood'`).
+        output (str, optional):
+            Descriptors to compute, either :code:`'sph'` to store the
+            spherical harmonics of every bond in :attr:`sph`, or
+            :code:`'power_spectrum'` to store only the power spectrum of
+            each query point in :attr:`power_spectrum`
+            (Default value = :code:`'sph'`).
     """  # noqa: E501
     cdef freud._environment.LocalDescriptors * thisptr
 
@@ -259,16 +310,26 @@ cdef class LocalDescriptors(_PairCompute):
                    'global': freud._environment.Global,
                    'particle_local': freud._environment.ParticleLocal}
 
-    def __cinit__(self, l_max, negative_m=True, mode='neighborhood'):
+    known_outputs = {'sph': freud._environment.BondHarmonics,
+                     'power_spectrum': freud._environment.PowerSpectrum}
+
+    def __cinit__(self, l_max, negative_m=True, mode='neighborhood',
+                  output='sph'):
         cdef freud._environment.LocalDescriptorOrientation l_mode
+        cdef freud._environment.LocalDescriptorOutput l_output
         try:
             l_mode = self.known_modes[mode]
         except KeyError:
             raise ValueError(
                 'Unknown LocalDescriptors orientation mode: {}'.format(mode))
+        try:
+            l_output = self.known_outputs[output]
+        except KeyError:
+            raise ValueError(
+                'Unknown LocalDescriptors output: {}'.format(output))
 
         self.thisptr = new freud._environment.LocalDescriptors(
-            l_max, negative_m, l_mode)
+            l_max, negative_m, l_mode, l_output)
 
     def __dealloc__(self):
         del self.thisptr
@@ -342,11 +403,29 @@ cdef class LocalDescriptors(_PairCompute):
     @_Compute._computed_property
     def sph(self):
         """:math:`\\left(N_{bonds}, \\text{SphWidth} \\right)`
-        :class:`numpy.ndarray`: The last computed spherical harmonic array."""
+        :class:`numpy.ndarray`: The last computed spherical harmonic array.
+        Only available when :code:`output='sph'`."""
+        if self.output != 'sph':
+            raise AttributeError(
+                "Bond spherical harmonics are only computed with "
+                "output='sph'.")
         return freud.util.make_managed_numpy_array(
             &self.thisptr.getSph(),
             freud.util.arr_type_t.COMPLEX_FLOAT)
 
+    @_Compute._computed_property
+    def power_spectrum(self):
+        """:math:`\\left(N_{query\\_points}, l_{max} + 1 \\right)`
+        :class:`numpy.ndarray`: The last computed power spectrum of each query
+        point. Only available when :code:`output='power_spectrum'`."""
+        if self.output != 'power_spectrum':
+            raise AttributeError(
+                "The power spectrum is only computed with "
+                "output='power_spectrum'.")
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getPowerSpectrum(),
+            freud.util.arr_type_t.FLOAT)
+
     @_Compute._computed_property
     def num_sphs(self):
         """unsigned int: The last number of spherical harmonics computed. This
@@ -380,11 +459,23 @@ cdef class LocalDescriptors(_PairCompute):
             if value == mode:
                 return key
 
+    @property
+    def output(self):
+        """str: Descriptors to compute, either :code:`'sph'` for the spherical
+        harmonics of every bond or :code:`'power_spectrum'` for the power
+        spectrum of each query point."""
+        output = self.thisptr.getOutput()
+        for key, value in self.known_outputs.items():
+            if value == output:
+                return key
+
     def __repr__(self):
         return ("freud.environment.{cls}(l_max={l_max}, "
-                "negative_m={negative_m}, mode='{mode}')").format(
+                "negative_m={negative_m}, mode='{mode}', "
+                "output='{output}')").format(
                     cls=type(self).__name__, l_max=self.l_max,
-                    negative_m=self.negative_m, mode=self.mode)
+                    negative_m=self.negative_m, mode=self.mode,
+                    output=self.output)
 
 
 def _minimize_RMSD(box, ref_points, points, registration=False):
@@ -1,8 +1,10 @@
 # Copyright (c) 2010-2020 The Regents of the University of Michigan
 # This file is from the freud project, released under the BSD 3-Clause License.
 
-from freud.util cimport _Compute
+from libcpp.vector cimport vector
+from freud.util cimport _Compute, vec3
 
+cimport freud._box
 cimport freud._locality
 cimport freud.box
 
@@ -59,10 +61,22 @@ cdef class _QueryArgs:
 cdef class _PairCompute(_Compute):
     pass
 
+cdef class _Trajectory:
+    cdef vector[freud._box.Box] boxes
+    cdef const float[:, :, ::1] points
+    cdef unsigned int n_frames
+    cdef unsigned int num_points
+    cdef _QueryArgs qargs
+
+    cdef const freud._box.Box * boxes_ptr(self)
+    cdef const vec3[float] * points_ptr(self)
+
 cdef class _SpatialHistogram(_PairCompute):
     cdef float r_max
     cdef freud._locality.BondHistogramCompute *histptr
 
+    cdef _Trajectory _preprocess_trajectory(self, boxes, points, neighbors)
+
 cdef class _SpatialHistogram1D(_SpatialHistogram):
     pass
 
@@ -961,6 +961,16 @@ cdef class _PairCompute(_Compute):
             NO_DEFAULT_QUERY_ARGS_MESSAGE.format(type(self).__name__))
 
 
+cdef class _Trajectory:
+    R"""Frames of a trajectory converted for :code:`accumulateTrajectory`."""
+
+    cdef const freud._box.Box * boxes_ptr(self):
+        return &self.boxes[0]
+
+    cdef const vec3[float] * points_ptr(self):
+        return <vec3[float]*> &self.points[0, 0, 0]
+
+
 cdef class _SpatialHistogram(_PairCompute):
     R"""Parent class for all compute classes in freud that perform a spatial
     binning of particle bonds by distance.
@@ -976,6 +986,44 @@ cdef class _SpatialHistogram(_PairCompute):
         :code:`{'mode': 'ball', 'r_max': self.r_max}`."""
         return dict(mode="ball", r_max=self.r_max)
 
+    cdef _Trajectory _preprocess_trajectory(self, boxes, points, neighbors):
+        """Process the arguments shared by :code:`compute_trajectory`
+        methods. The histogram is not reset here; callers reset it only after
+        validating their own arrays, so bad input keeps accumulated data.
+
+        The arguments are documented in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Returns:
+            :class:`_Trajectory`: The boxes, points, and query arguments.
+        """
+        points = freud.util._convert_array(points, shape=(None, None, 3))
+        n_frames = points.shape[0]
+        if n_frames == 0 or points.shape[1] == 0:
+            raise ValueError(
+                "A trajectory must contain at least one frame and point.")
+        if isinstance(boxes, freud.box.Box):
+            boxes = [boxes] * n_frames
+        if len(boxes) != n_frames:
+            raise ValueError(
+                "The number of boxes ({}) must match the number of frames "
+                "({}).".format(len(boxes), n_frames))
+        if type(neighbors) == NeighborList:
+            raise ValueError(
+                "A NeighborList cannot be used for a trajectory, neighbors "
+                "must be a dict of query arguments.")
+
+        cdef _Trajectory trajectory = _Trajectory()
+        cdef freud.box.Box b
+        for box in boxes:
+            b = freud.util._convert_box(box)
+            trajectory.boxes.push_back(dereference(b.thisptr))
+        trajectory.points = points
+        trajectory.n_frames = n_frames
+        trajectory.num_points = points.shape[1]
+        _, trajectory.qargs = self._resolve_neighbors(neighbors)
+        return trajectory
+
     @_Compute._computed_property
     def box(self):
         """:class:`freud.box.Box`: The box object used in the last
@@ -1017,6 +1065,26 @@ cdef class _SpatialHistogram(_PairCompute):
         histogram."""
         return list(self.histptr.getAxisSizes())
 
+    @property
+    def tile_size(self):
+        """int: The number of bins per tile of the per-thread histograms, or
+        0 if they are stored densely (the default).
+
+        With a nonzero tile size, each thread only allocates the tiles of
+        consecutive bins that it counts bonds in, so memory use while
+        accumulating is bounded by the occupied bins rather than the
+        resolution of the histogram. Dense arrays are only created when
+        results are accessed. Setting this discards any accumulated data.
+        """
+        return self.histptr.getTileSize()
+
+    @tile_size.setter
+    def tile_size(self, value):
+        if value < 0:
+            raise ValueError("The tile size must be nonnegative.")
+        self.histptr.setTileSize(value)
+        self._called_compute = False
+
     def _reset(self):
         # Resets the values of RDF in memory.
         self.histptr.reset()
@@ -7,59 +7,18 @@ mean-squared-displacement (MSD) of particles in periodic systems.
 """
 
 import numpy as np
-import freud.parallel
-import logging
+import freud.util
 
-from freud.util cimport _Compute
+from cython.operator cimport dereference
+from freud.util cimport _Compute, vec3
+
+cimport freud._box
+cimport freud._msd
 cimport freud.box
+cimport freud.util
 cimport numpy as np
 
 
-logger = logging.getLogger(__name__)
-
-# Use fastest available fft library
-try:
-    import pyfftw
-    logger.info("Using PyFFTW for FFTs")
-
-    pyfftw.config.NUM_THREADS = min(1, freud.parallel.get_num_threads())
-    logger.info("Setting number of threads to {}".format(
-        freud.parallel.get_num_threads()))
-
-    # Note that currently these functions are defined to match only the parts
-    # of the numpy/scipy API that are actually used below. There is no promise
-    # that other aspects of the API will be preserved.
-    def fft(x, n, axis):
-        a = pyfftw.empty_aligned(x.shape, 'complex64')
-        a[:] = x
-        fft_object = pyfftw.builders.fft(a, n=n, axis=axis)
-        return fft_object()
-
-    def ifft(x, axis):
-        a = pyfftw.empty_aligned(x.shape, 'complex64')
-        a[:] = x
-        fft_object = pyfftw.builders.ifft(a, axis=axis)
-        return fft_object()
-except ImportError:
-    try:
-        from scipy.fftpack import fft, ifft
-        logger.info("Using SciPy's fftpack for FFTs")
-    except ImportError:
-        from numpy.fft import fft, ifft
-        logger.info("Using NumPy for FFTs")
-
-
-def _autocorrelation(x):
-    R"""Compute the autocorrelation of a sequence"""
-    N = x.shape[0]
-    F = fft(x, n=2*N, axis=0)
-    PSD = F * F.conjugate()
-    res = ifft(PSD, axis=0)
-    res = (res[:N]).real
-    n = np.arange(1, N+1)[::-1]  # N to 1
-    return res/n[:, np.newaxis]
-
-
 cdef class MSD(_Compute):
     R"""Compute the mean squared displacement.
 
@@ -92,21 +51,10 @@ cdef class MSD(_Compute):
       <https://stackoverflow.com/questions/34222272/computing-mean-square-displacement-using-python-and-fft>`_.
 
       .. note::
-          The most intensive part of this calculation is computing an FFT. To
-          maximize performance, freud attempts to use the fastest FFT library
-          available. By default, the order of preference is `pyFFTW
-          <https://github.com/pyFFTW/pyFFTW>`_, SciPy, and then NumPy. If you
-          are experiencing significant slowdowns in calculating the MSD, you
-          may benefit from installing a faster FFT library, which freud will
-          automatically detect. The performance change will be especially
-          noticeable if the length of your trajectory is a number whose prime
-          factorization consists of extremely large prime factors. The
-          standard Cooley-Tukey FFT algorithm performs very poorly in this
-          case, so installing pyFFTW will significantly improve performance.
-
-          Note that while pyFFTW is released under the BSD 3-Clause license,
-          the FFTW library is available under either GPL or a commercial
-          license.
+          The FFTs are computed with a radix-2 FFT bundled with freud, with
+          the trajectory padded to a power of two frames, so the performance
+          does not depend on the prime factorization of the number of frames.
+          Particles are processed in parallel.
 
     * :code:`'direct'`:
       Under some circumstances, however, we may be more interested in
@@ -139,23 +87,39 @@ cdef class MSD(_Compute):
             Mode of calculation. Options are :code:`'window'` and
             :code:`'direct'`.  (Default value = :code:`'window'`).
     """   # noqa: E501
+    cdef freud._msd.MSD * thisptr
     cdef freud.box.Box _box
     cdef _particle_msd
+    cdef _msd_sum
+    cdef unsigned int _num_particles
     cdef str mode
 
+    known_modes = {'window': freud._msd.Window,
+                   'direct': freud._msd.Direct}
+
     def __cinit__(self, box=None, mode='window'):
+        cdef freud._msd.MSDMode l_mode
         if box is not None:
             self._box = freud.util._convert_box(box)
         else:
             self._box = None
 
         self._particle_msd = []
+        self._msd_sum = None
+        self._num_particles = 0
 
-        if mode not in ['window', 'direct']:
+        try:
+            l_mode = self.known_modes[mode]
+        except KeyError:
             raise ValueError("Invalid mode")
         self.mode = mode
+        self.thisptr = new freud._msd.MSD(l_mode)
+
+    def __dealloc__(self):
+        del self.thisptr
 
-    def compute(self, positions, images=None, reset=True):
+    def compute(self, positions, images=None, reset=True,
+                chunk_size=None, keep_particle_msd=True):
         """Calculate the MSD for the positions provided.
 
         .. note::
@@ -184,50 +148,104 @@ cdef class MSD(_Compute):
                 Whether to erase the previously computed values before adding
                 the new computation; if False, will accumulate data (Default
                 value: True).
+            chunk_size (int, optional):
+                If provided, the MSD is computed for at most this many
+                particles at a time, and only the positions and images of
+                those particles are copied. Combined with a memory-mapped
+                array such as :class:`numpy.memmap` and
+                :code:`keep_particle_msd=False`, this bounds the memory used
+                for trajectories that do not fit in memory. If
+                :code:`None`, all particles are computed at once.
+                (Default value = :code:`None`).
+            keep_particle_msd (bool, optional):
+                Whether to store the per-particle MSD. If False, only the
+                running sum over particles needed for :attr:`msd` is kept, so
+                the memory used no longer grows with the number of particles
+                and :attr:`particle_msd` is unavailable until the next reset.
+                (Default value = :code:`True`).
         """  # noqa: E501
         if reset:
             self._particle_msd = []
+            self._msd_sum = None
+            self._num_particles = 0
+
+        # Arrays, including memory-mapped arrays, are sliced into chunks
+        # without copying them.
+        if not isinstance(positions, np.ndarray):
+            positions = np.asarray(positions)
+        if images is not None and not isinstance(images, np.ndarray):
+            images = np.asarray(images)
+        if positions.ndim != 3 or positions.shape[2] != 3:
+            raise ValueError(
+                "positions must have shape (N_frames, N_particles, 3).")
+        if images is not None and images.shape != positions.shape:
+            raise ValueError("images must have the same shape as positions.")
+        if self._msd_sum is not None and \
+                positions.shape[0] != self._msd_sum.shape[0]:
+            raise ValueError(
+                "The number of frames ({}) must match the number of frames "
+                "of previous computes ({}).".format(
+                    positions.shape[0], self._msd_sum.shape[0]))
+        if self._msd_sum is None:
+            self._msd_sum = np.zeros(positions.shape[0])
+
+        num_particles = positions.shape[1]
+        if chunk_size is None:
+            chunk_size = max(num_particles, 1)
+        elif chunk_size < 1:
+            raise ValueError("chunk_size must be a positive integer.")
+
+        for start in range(0, num_particles, chunk_size):
+            stop = min(start + chunk_size, num_particles)
+            self._compute_chunk(positions[:, start:stop],
+                                images[:, start:stop]
+                                if images is not None else None,
+                                keep_particle_msd)
 
         self._called_compute = True
+        return self
 
+    def _compute_chunk(self, positions, images, keep_particle_msd):
+        R"""Compute the MSD of a subset of the particles and add it to the
+        running sum, storing the per-particle result if requested."""
         positions = freud.util._convert_array(
             positions, shape=(None, None, 3))
-        if images is not None:
-            images = freud.util._convert_array(
-                images, shape=positions.shape, dtype=np.int32)
-
-        # Make sure we aren't modifying the provided array
-        if self._box is not None and images is not None:
-            unwrapped_positions = positions.copy()
-            for i in range(positions.shape[0]):
-                unwrapped_positions[i, :, :] = self._box.unwrap(
-                    unwrapped_positions[i, :, :], images[i, :, :])
-            positions = unwrapped_positions
-
-        if self.mode == 'window':
-            # First compute the first term r^2(k+m) - r^2(k)
-            N = positions.shape[0]
-            D = np.square(positions).sum(axis=2)
-            D = np.append(D, np.zeros(positions.shape[:2]), axis=0)
-            Q = 2*D.sum(axis=0)
-            S1 = np.zeros(positions.shape[:2])
-            for m in range(N):
-                Q -= (D[m-1, :] + D[N-m, :])
-                S1[m, :] = Q/(N-m)
-
-            # The second term can be computed via autocorrelation
-            corrs = []
-            for i in range(positions.shape[2]):
-                corrs.append(_autocorrelation(positions[:, :, i]))
-            S2 = np.sum(corrs, axis=0)
-
-            self._particle_msd.append(S1 - 2*S2)
-        elif self.mode == 'direct':
-            self._particle_msd.append(
-                np.linalg.norm(
-                    positions - positions[[0], :, :], axis=-1)**2)
-
-        return self
+        cdef const float[:, :, ::1] l_positions = positions
+        cdef unsigned int n_frames = l_positions.shape[0]
+        cdef unsigned int n_particles = l_positions.shape[1]
+
+        # Images are only used if there is a box to unwrap with.
+        cdef const int[:, :, ::1] l_images
+        cdef vec3[int] *l_images_ptr = NULL
+        cdef freud._box.Box l_box
+        if self._box is not None:
+            l_box = dereference(self._box.thisptr)
+            if images is not None:
+                images = freud.util._convert_array(
+                    images, shape=positions.shape, dtype=np.int32)
+                l_images = images
+                if n_frames > 0 and n_particles > 0:
+                    l_images_ptr = <vec3[int]*> &l_images[0, 0, 0]
+
+        if n_frames > 0 and n_particles > 0:
+            self.thisptr.compute(
+                <vec3[float]*> &l_positions[0, 0, 0], l_images_ptr, l_box,
+                n_frames, n_particles)
+            particle_msd = freud.util.make_managed_numpy_array(
+                &self.thisptr.getParticleMSD(),
+                freud.util.arr_type_t.DOUBLE)
+        else:
+            particle_msd = np.zeros((n_frames, n_particles))
+
+        self._msd_sum += particle_msd.sum(axis=1)
+        self._num_particles += n_particles
+        # A chunk that is not kept drops the reference to the buffer, which
+        # is then reused by the next chunk. Once any chunk is dropped, the
+        # per-particle MSD can no longer be assembled.
+        if keep_particle_msd and self._particle_msd is not None:
+            self._particle_msd.append(particle_msd)
+        else:
+            self._particle_msd = None
 
     @property
     def box(self):
@@ -238,12 +256,18 @@ cdef class MSD(_Compute):
     def msd(self):
         """:math:`\\left(N_{frames}, \\right)` :class:`numpy.ndarray`: The mean
         squared displacement."""
-        return np.concatenate(self._particle_msd, axis=1).mean(axis=-1)
+        if self._num_particles == 0:
+            return np.full(self._msd_sum.shape, np.nan)
+        return self._msd_sum / self._num_particles
 
     @_Compute._computed_property
     def particle_msd(self):
         """:math:`\\left(N_{frames}, N_{particles} \\right)` :class:`numpy.ndarray`: The per
         particle based mean squared displacement."""  # noqa: E501
+        if self._particle_msd is None:
+            raise AttributeError(
+                "The per-particle MSD was not kept, compute with "
+                "keep_particle_msd=True to access it.")
         return np.concatenate(self._particle_msd, axis=1)
 
     def __repr__(self):
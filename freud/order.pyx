@@ -20,6 +20,7 @@ from freud.util cimport _Compute, vec3, quat
 from freud.errors import FreudDeprecationWarning
 from freud.locality cimport _PairCompute
 from cython.operator cimport dereference
+from libcpp.vector cimport vector
 
 cimport freud._order
 cimport freud.locality
@@ -32,10 +33,29 @@ logger = logging.getLogger(__name__)
 # _always_ do that, or you will have segfaults
 np.import_array()
 
+
+def _convert_deferred_orientations(orientations):
+    R"""Convert orientations that are used after :code:`compute` returns.
+
+    Per-particle outputs that are computed on first access keep the
+    orientations until then, so an array that shares memory with the
+    caller's array is copied. Otherwise, a caller reusing its buffer for the
+    next frame would silently change the result."""
+    converted = freud.util._convert_array(orientations, shape=(None, 4))
+    if np.may_share_memory(converted, orientations):
+        converted = converted.copy()
+    return converted
+
 cdef class Cubatic(_Compute):
     R"""Compute the cubatic order parameter :cite:`Haji_Akbari_2015` for a system of
     particles using simulated annealing instead of Newton-Raphson root finding.
 
+    Alternatively, the :code:`'gradient'` optimizer finds the cubatic
+    orientation deterministically. It uses power iteration of the quartic form
+    of the global tensor to find candidate axes, then refines each candidate
+    frame by gradient ascent on rotations. It is typically much faster than
+    simulated annealing and does not depend on the random seed.
+
     Args:
         t_initial (float):
             Starting temperature.
@@ -49,15 +69,32 @@ cdef class Cubatic(_Compute):
         seed (unsigned int, optional):
             Random seed to use in calculations. If :code:`None`, system time is used.
             (Default value = :code:`None`).
+        optimizer (str, optional):
+            Method used to find the cubatic orientation, either
+            :code:`'annealing'` for simulated annealing or :code:`'gradient'`
+            for the deterministic optimizer, which ignores the temperatures,
+            scale, replicates, and seed (Default value = :code:`'annealing'`).
     """  # noqa: E501
     cdef freud._order.Cubatic * thisptr
+    cdef object _orientations
 
-    def __cinit__(self, t_initial, t_final, scale, n_replicates=1, seed=None):
+    known_optimizers = {'annealing': freud._order.SimulatedAnnealing,
+                        'gradient': freud._order.GradientAscent}
+
+    def __cinit__(self, t_initial, t_final, scale, n_replicates=1, seed=None,
+                  optimizer='annealing'):
         if seed is None:
             seed = int(time.time())
 
+        cdef freud._order.CubaticOptimizer l_optimizer
+        try:
+            l_optimizer = self.known_optimizers[optimizer]
+        except KeyError:
+            raise ValueError(
+                'Unknown Cubatic optimizer: {}'.format(optimizer))
+
         self.thisptr = new freud._order.Cubatic(
-            t_initial, t_final, scale, n_replicates, seed)
+            t_initial, t_final, scale, n_replicates, seed, l_optimizer)
 
     def __dealloc__(self):
         del self.thisptr
@@ -69,14 +106,14 @@ cdef class Cubatic(_Compute):
             orientations ((:math:`N_{particles}`, 4) :class:`numpy.ndarray`):
                 Orientations as angles to use in computation.
         """
-        orientations = freud.util._convert_array(
-            orientations, shape=(None, 4))
+        orientations = _convert_deferred_orientations(orientations)
 
         cdef const float[:, ::1] l_orientations = orientations
         cdef unsigned int num_particles = l_orientations.shape[0]
 
         self.thisptr.compute(
-            <quat[float]*> &l_orientations[0, 0], num_particles)
+            <quat[float]*> &l_orientations[0, 0], num_particles, False)
+        self._orientations = orientations
         return self
 
     @property
@@ -104,6 +141,14 @@ cdef class Cubatic(_Compute):
         """unsigned int: Random seed to use in calculations."""
         return self.thisptr.getSeed()
 
+    @property
+    def optimizer(self):
+        """str: Method used to find the cubatic orientation."""
+        optimizer = self.thisptr.getOptimizer()
+        for key, value in self.known_optimizers.items():
+            if value == optimizer:
+                return key
+
     @_Compute._computed_property
     def order(self):
         """float: Cubatic order parameter of the system."""
@@ -119,7 +164,13 @@ cdef class Cubatic(_Compute):
     @_Compute._computed_property
     def particle_order(self):
         """:math:`\\left(N_{particles} \\right)` :class:`numpy.ndarray`: Order
-        parameter."""
+        parameter, computed on first access."""
+        cdef const float[:, ::1] l_orientations
+        if self._orientations is not None:
+            l_orientations = self._orientations
+            self.thisptr.computeParticleOrderParameter(
+                <quat[float]*> &l_orientations[0, 0])
+            self._orientations = None
         return freud.util.make_managed_numpy_array(
             &self.thisptr.getParticleOrderParameter(),
             freud.util.arr_type_t.FLOAT)
@@ -144,12 +195,14 @@ cdef class Cubatic(_Compute):
     def __repr__(self):
         return ("freud.order.{cls}(t_initial={t_initial}, t_final={t_final}, "
                 "scale={scale}, n_replicates={n_replicates}, "
-                "seed={seed})").format(cls=type(self).__name__,
-                                       t_initial=self.t_initial,
-                                       t_final=self.t_final,
-                                       scale=self.scale,
-                                       n_replicates=self.n_replicates,
-                                       seed=self.seed)
+                "seed={seed}, optimizer='{optimizer}')").format(
+                    cls=type(self).__name__,
+                    t_initial=self.t_initial,
+                    t_final=self.t_final,
+                    scale=self.scale,
+                    n_replicates=self.n_replicates,
+                    seed=self.seed,
+                    optimizer=self.optimizer)
 
 
 cdef class Nematic(_Compute):
@@ -161,6 +214,7 @@ cdef class Nematic(_Compute):
             (without any rotation applied).
     """
     cdef freud._order.Nematic *thisptr
+    cdef object _orientations
 
     def __cinit__(self, u):
         # run checks
@@ -188,14 +242,14 @@ cdef class Nematic(_Compute):
             orientations (:math:`\left(N_{particles}, 4 \right)` :class:`numpy.ndarray`):
                 Orientations to calculate the order parameter.
         """   # noqa: E501
-        orientations = freud.util._convert_array(
-            orientations, shape=(None, 4))
+        orientations = _convert_deferred_orientations(orientations)
 
         cdef const float[:, ::1] l_orientations = orientations
         cdef unsigned int num_particles = l_orientations.shape[0]
 
         self.thisptr.compute(<quat[float]*> &l_orientations[0, 0],
-                             num_particles)
+                             num_particles, False)
+        self._orientations = orientations
         return self
 
     @_Compute._computed_property
@@ -214,7 +268,13 @@ cdef class Nematic(_Compute):
     def particle_tensor(self):
         """:math:`\\left(N_{particles}, 3, 3 \\right)` :class:`numpy.ndarray`:
             One 3x3 matrix per-particle corresponding to each individual
-            particle orientation."""
+            particle orientation, computed on first access."""
+        cdef const float[:, ::1] l_orientations
+        if self._orientations is not None:
+            l_orientations = self._orientations
+            self.thisptr.computeParticleTensor(
+                <quat[float]*> &l_orientations[0, 0])
+            self._orientations = None
         return freud.util.make_managed_numpy_array(
             &self.thisptr.getParticleTensor(),
             freud.util.arr_type_t.FLOAT)
@@ -275,13 +335,23 @@ cdef class Hexatic(_PairCompute):
     not rotationally invariant because of this phase angle, but the magnitude
     *is* rotationally invariant.
 
+    Multiple values of :math:`k` may be computed in a single pass by providing
+    a sequence of values for :code:`k`, which is useful for comparing
+    different symmetries. The factor :math:`e^{i \phi_{ij}}` of each bond is
+    computed once and raised to every requested :math:`k` by successive
+    multiplication, and the output has shape
+    :math:`\left(N_{particles}, N_k\right)`. If :code:`k` is a single
+    integer rather than a sequence, the output has shape
+    :math:`\left(N_{particles}\right)`.
+
     .. note::
         **2D:** :class:`freud.order.Hexatic` is only defined for 2D systems.
         The points must be passed in as :code:`[x, y, 0]`.
 
     Args:
-        k (unsigned int, optional):
-            Symmetry of order parameter (Default value = :code:`6`).
+        k (unsigned int or sequence of unsigned int, optional):
+            Symmetry of order parameter, or several symmetries to compute
+            together (Default value = :code:`6`).
         weighted (bool, optional):
             Determines whether to use neighbor weights in the computation of
             spherical harmonics over neighbors. If enabled and used with a
@@ -290,9 +360,12 @@ cdef class Hexatic(_PairCompute):
             :code:`False`).
     """  # noqa: E501
     cdef freud._order.Hexatic * thisptr
+    cdef bint _scalar_k
 
     def __cinit__(self, k=6, weighted=False):
-        self.thisptr = new freud._order.Hexatic(k, weighted)
+        cdef vector[unsigned int] k_values = np.atleast_1d(k).tolist()
+        self._scalar_k = np.ndim(k) == 0
+        self.thisptr = new freud._order.Hexatic(k_values, weighted)
 
     def __dealloc__(self):
         del self.thisptr
@@ -338,21 +411,26 @@ cdef class Hexatic(_PairCompute):
     @property
     def default_query_args(self):
         """The default query arguments are
-        :code:`{'mode': 'nearest', 'num_neighbors': self.k}`."""
-        return dict(mode="nearest", num_neighbors=self.k)
+        :code:`{'mode': 'nearest', 'num_neighbors': max(self.k)}`."""
+        return dict(mode="nearest", num_neighbors=max(np.atleast_1d(self.k)))
 
     @_Compute._computed_property
     def particle_order(self):
-        """:math:`\\left(N_{particles} \\right)` :class:`numpy.ndarray`: Order
-        parameter."""
-        return freud.util.make_managed_numpy_array(
+        """:math:`\\left(N_{particles} \\right)` or
+        :math:`\\left(N_{particles}, N_k\\right)` :class:`numpy.ndarray`:
+        Order parameter, with the second axis only when :code:`k` is a
+        sequence."""
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getOrder(),
             freud.util.arr_type_t.COMPLEX_FLOAT)
+        return np.ravel(array) if self._scalar_k else array
 
     @property
     def k(self):
-        """unsigned int: Symmetry of the order parameter."""
-        return self.thisptr.getK()
+        """unsigned int or list[unsigned int]: Symmetry of the order
+        parameter."""
+        k_values = list(self.thisptr.getK())
+        return k_values[0] if self._scalar_k else k_values
 
     @property
     def weighted(self):
@@ -375,9 +453,11 @@ cdef class Hexatic(_PairCompute):
             (:class:`matplotlib.axes.Axes`): Axis with the plot.
         """
         import freud.plot
-        xlabel = r"$\left|\psi{prime}_{k}\right|$".format(
-            prime='\'' if self.weighted else '',
-            k=self.k)
+        xlabel = ", ".join(
+            r"$\left|\psi{prime}_{k}\right|$".format(
+                prime='\'' if self.weighted else '',
+                k=k)
+            for k in np.atleast_1d(self.k))
 
         return freud.plot.histogram_plot(
             np.absolute(self.particle_order),
@@ -468,9 +548,9 @@ cdef class Translational(_PairCompute):
     def particle_order(self):
         """:math:`\\left(N_{particles} \\right)` :class:`numpy.ndarray`: Order
         parameter."""
-        return freud.util.make_managed_numpy_array(
+        return np.ravel(freud.util.make_managed_numpy_array(
             &self.thisptr.getOrder(),
-            freud.util.arr_type_t.COMPLEX_FLOAT)
+            freud.util.arr_type_t.COMPLEX_FLOAT))
 
     @property
     def k(self):
@@ -531,6 +611,13 @@ cdef class Steinhardt(_PairCompute):
     :math:`q_{lm}` values over all particles before computing the order
     parameter of choice.
 
+    Multiple values of :math:`l` may be computed in a single pass by providing
+    a sequence of values for :code:`l`. The spherical harmonics of each bond
+    are then evaluated once for all requested :math:`l`, and the per-particle
+    outputs have shape :math:`\left(N_{particles}, N_l\right)`, even if the
+    sequence has a single value. If :code:`l` is a single integer, outputs
+    have shape :math:`\left(N_{particles}\right)`.
+
     .. note::
         The value of per-particle order parameter will be set to NaN for
         particles with no neighbors. We choose this value rather than setting
@@ -542,8 +629,8 @@ cdef class Steinhardt(_PairCompute):
         NumPy: :code:`numpy.nan_to_num(particle_order)`.
 
     Args:
-        l (unsigned int):
-            Spherical harmonic quantum number l.
+        l (unsigned int or sequence of unsigned int):
+            One or more spherical harmonic quantum numbers l to compute.
         average (bool, optional):
             Determines whether to calculate the averaged Steinhardt order
             parameter (Default value = :code:`False`).
@@ -561,11 +648,14 @@ cdef class Steinhardt(_PairCompute):
             of the Steinhardt order parameter (Default value = :code:`False`).
     """  # noqa: E501
     cdef freud._order.Steinhardt * thisptr
+    cdef bint _scalar_l
 
     def __cinit__(self, l, average=False, wl=False, weighted=False,
                   wl_normalize=False):
-        self.thisptr = new freud._order.Steinhardt(l, average, wl, weighted,
-                                                   wl_normalize)
+        cdef vector[unsigned int] l_values = np.atleast_1d(l).tolist()
+        self._scalar_l = np.ndim(l) == 0
+        self.thisptr = new freud._order.Steinhardt(l_values, average, wl,
+                                                   weighted, wl_normalize)
 
     def __dealloc__(self):
         del self.thisptr
@@ -593,33 +683,57 @@ cdef class Steinhardt(_PairCompute):
 
     @property
     def l(self):  # noqa: E743
-        """unsigned int: Spherical harmonic quantum number l."""
-        return self.thisptr.getL()
+        """unsigned int or list[unsigned int]: Spherical harmonic quantum
+        number(s) l."""
+        l_values = list(self.thisptr.getL())
+        return l_values[0] if self._scalar_l else l_values
 
     @_Compute._computed_property
     def order(self):
-        """float: The system wide normalization of the :math:`q_l` or
-        :math:`w_l` order parameter."""
-        return self.thisptr.getOrder()
+        """float or :math:`\\left(N_l\\right)` :class:`numpy.ndarray`: The
+        system wide normalization of the :math:`q_l` or :math:`w_l` order
+        parameter."""
+        order = freud.util.make_managed_numpy_array(
+            &self.thisptr.getOrder(),
+            freud.util.arr_type_t.FLOAT)
+        return order[0] if self._scalar_l else order
 
     @_Compute._computed_property
     def particle_order(self):
-        """:math:`\\left(N_{particles}\\right)` :class:`numpy.ndarray`: Variant
-        of the Steinhardt order parameter for each particle (filled with
-        :code:`nan` for particles with no neighbors)."""
-        return freud.util.make_managed_numpy_array(
+        """:math:`\\left(N_{particles}\\right)` or :math:`\\left(N_{particles},
+        N_l\\right)` :class:`numpy.ndarray`: Variant of the Steinhardt order
+        parameter for each particle (filled with :code:`nan` for particles with
+        no neighbors)."""
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getParticleOrder(),
             freud.util.arr_type_t.FLOAT)
+        return np.ravel(array) if self._scalar_l else array
 
     @_Compute._computed_property
     def ql(self):
-        """:math:`\\left(N_{particles}\\right)` :class:`numpy.ndarray`:
-        :math:`q_l` Steinhardt order parameter for each particle (filled with
-        :code:`nan` for particles with no neighbors). This is always available,
-        no matter which options are selected."""
-        return freud.util.make_managed_numpy_array(
+        """:math:`\\left(N_{particles}\\right)` or :math:`\\left(N_{particles},
+        N_l\\right)` :class:`numpy.ndarray`: :math:`q_l` Steinhardt order
+        parameter for each particle (filled with :code:`nan` for particles with
+        no neighbors). This is always available, no matter which options are
+        selected."""
+        array = freud.util.make_managed_numpy_array(
             &self.thisptr.getQl(),
             freud.util.arr_type_t.FLOAT)
+        return np.ravel(array) if self._scalar_l else array
+
+    @_Compute._computed_property
+    def particle_harmonics(self):
+        """:math:`\\left(N_{particles}, 2l+1\\right)` :class:`numpy.ndarray`
+        or list of such arrays: The raw array of :math:`\\overline{q}_{lm}(i)`
+        for each requested :math:`l`. The array is provided in the order
+        :math:`m = 0, 1, ..., l, -1, ..., -l`."""
+        cdef size_t l_index
+        harmonics = []
+        for l_index in range(self.thisptr.getL().size()):
+            harmonics.append(freud.util.make_managed_numpy_array(
+                &self.thisptr.getQlm()[l_index],
+                freud.util.arr_type_t.COMPLEX_FLOAT))
+        return harmonics[0] if self._scalar_l else harmonics
 
     def compute(self, system, neighbors=None):
         R"""Compute the order parameter.
@@ -679,11 +793,13 @@ cdef class Steinhardt(_PairCompute):
             (:class:`matplotlib.axes.Axes`): Axis with the plot.
         """
         import freud.plot
-        xlabel = r"${mode_letter}{prime}_{{{sph_l}{average}}}$".format(
-            mode_letter='w' if self.wl else 'q',
-            prime='\'' if self.weighted else '',
-            sph_l=self.l,
-            average=',ave' if self.average else '')
+        xlabel = ", ".join(
+            r"${mode_letter}{prime}_{{{sph_l}{average}}}$".format(
+                mode_letter='w' if self.wl else 'q',
+                prime='\'' if self.weighted else '',
+                sph_l=sph_l,
+                average=',ave' if self.average else '')
+            for sph_l in np.atleast_1d(self.l))
 
         return freud.plot.histogram_plot(
             self.particle_order,
@@ -836,6 +952,35 @@ cdef class SolidLiquid(_PairCompute):
             &self.thisptr.getNumberOfConnections(),
             freud.util.arr_type_t.UNSIGNED_INT)
 
+    def sweep_thresholds(self, q_thresholds, solid_thresholds):
+        R"""Find the largest solid-like cluster for several thresholds.
+
+        The bond dot products :math:`q_l(i, j)` from the last call to
+        :meth:`compute` are reused, so only the bond filtering and clustering
+        are repeated for each pair of thresholds. The thresholds used by
+        :meth:`compute` and the computed attributes are unchanged.
+
+        Args:
+            q_thresholds (:math:`\left(N_{pairs}\right)` :class:`numpy.ndarray`):
+                Dot product threshold for each pair.
+            solid_thresholds (:math:`\left(N_{pairs}\right)` :class:`numpy.ndarray`):
+                Number-of-bonds threshold for each pair.
+
+        Returns:
+            :math:`\left(N_{pairs}\right)` :class:`numpy.ndarray`:
+                The largest cluster size for each pair of thresholds.
+        """  # noqa: E501
+        if not self._called_compute:
+            raise AttributeError(
+                "The compute method must be called before sweeping "
+                "thresholds.")
+        cdef vector[float] l_q_thresholds = np.atleast_1d(
+            q_thresholds).astype(np.float32).tolist()
+        cdef vector[unsigned int] l_solid_thresholds = np.atleast_1d(
+            solid_thresholds).astype(np.uint32).tolist()
+        return np.asarray(self.thisptr.sweepThresholds(
+            l_q_thresholds, l_solid_thresholds), dtype=np.uint32)
+
     def __repr__(self):
         return ("freud.order.{cls}(l={sph_l}, q_threshold={q_threshold}, "
                 "solid_threshold={solid_threshold}, "
@@ -896,7 +1041,9 @@ cdef class RotationalAutocorrelation(_Compute):
     correlation with an initial state. As such, the output can be treated as an
     order parameter measuring degrees of rotational (de)correlation. For
     analysis of a trajectory, the compute call needs to be
-    done at each trajectory frame.
+    done at each trajectory frame. Alternatively,
+    :meth:`compute_trajectory` computes the autocorrelation for all lag times
+    of a whole trajectory at once, averaged over all time origins.
 
     Args:
         l (int):
@@ -904,6 +1051,7 @@ cdef class RotationalAutocorrelation(_Compute):
             integer.
     """
     cdef freud._order.RotationalAutocorrelation * thisptr
+    cdef bint _called_trajectory
 
     def __cinit__(self, l):
         if l % 2 or l < 0:
@@ -938,6 +1086,44 @@ cdef class RotationalAutocorrelation(_Compute):
             nP)
         return self
 
+    def compute_trajectory(self, orientations):
+        R"""Calculates the rotational autocorrelation function of a trajectory
+        for all lag times.
+
+        The value for a lag of :math:`\Delta t` frames is the average of
+        :attr:`order` over all pairs of frames :math:`(t, t + \Delta t)` in
+        the trajectory. The harmonics of each orientation are computed once
+        per frame and correlated in time using fast Fourier transforms, so
+        the cost is proportional to :math:`N_{frames} \log N_{frames}`
+        rather than :math:`N_{frames}^2`.
+
+        Args:
+            orientations ((:math:`N_{frames}`, :math:`N_{orientations}`, 4) :class:`numpy.ndarray`):
+                Orientations for each frame of the trajectory.
+        """  # noqa: E501
+        orientations = freud.util._convert_array(
+            orientations, shape=(None, None, 4))
+
+        cdef const float[:, :, ::1] l_orientations = orientations
+        cdef unsigned int n_frames = l_orientations.shape[0]
+        cdef unsigned int nP = l_orientations.shape[1]
+
+        self.thisptr.computeTrajectory(
+            <quat[float]*> &l_orientations[0, 0, 0], n_frames, nP)
+        self._called_trajectory = True
+        return self
+
+    @property
+    def lag_order(self):
+        """(:math:`N_{frames}`) :class:`numpy.ndarray`: Autocorrelation of the
+        system for each lag time, computed by :meth:`compute_trajectory`."""
+        if not self._called_trajectory:
+            raise AttributeError(
+                "Property not computed. Call compute_trajectory first.")
+        return freud.util.make_managed_numpy_array(
+            &self.thisptr.getLagAutocorrelation(),
+            freud.util.arr_type_t.FLOAT)
+
     @_Compute._computed_property
     def order(self):
         """float: Autocorrelation of the system."""
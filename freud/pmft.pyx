@@ -94,6 +94,19 @@ def _gen_angle_array(orientations, shape):
         np.asarray(orientations).squeeze(), shape[0])), shape=shape)
 
 
+def _gen_trajectory_angle_array(orientations, n_frames, num_points):
+    """Generates a flat array of angles for all frames of a trajectory from
+    an array of angles or quaternions with a leading frame dimension."""
+    orientations = np.asarray(orientations)
+    if orientations.ndim == 3:
+        orientations = freud.util._convert_array(
+            orientations, shape=(n_frames, num_points, 4)).reshape(-1, 4)
+    else:
+        orientations = freud.util._convert_array(
+            orientations, shape=(n_frames, num_points)).reshape(-1)
+    return _gen_angle_array(orientations, shape=(n_frames * num_points, ))
+
+
 cdef class _PMFT(_SpatialHistogram):
     R"""Compute the PMFT :cite:`vanAnders:2014aa,van_Anders_2013` for a
     given set of points.
@@ -225,6 +238,38 @@ cdef class PMFTR12(_PMFT):
                                    dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, orientations, neighbors=None,
+                           reset=True):
+        R"""Calculates the PMFT of all frames of a trajectory.
+
+        The remaining arguments are as in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Args:
+            orientations ((:math:`N_{frames}`, :math:`N_{points}`, 4) or (:math:`N_{frames}`, :math:`N_{points}`) :class:`numpy.ndarray`):
+                Orientations associated with the points of each frame. If the
+                array is two-dimensional, the values are treated as angles in
+                radians corresponding to **counterclockwise** rotations about
+                the z axis.
+        """  # noqa: E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        orientations = _gen_trajectory_angle_array(
+            orientations, n_frames, num_points)
+        cdef const float[::1] l_orientations = orientations
+
+        if reset:
+            self._reset()
+        self.pmftr12ptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            <float*> &l_orientations[0], n_frames, num_points,
+            dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     def __repr__(self):
         bounds = self.bounds
         return ("freud.pmft.{cls}(r_max={r_max}, bins=({bins}))").format(
@@ -334,6 +379,38 @@ cdef class PMFTXYT(_PMFT):
                                    dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, orientations, neighbors=None,
+                           reset=True):
+        R"""Calculates the PMFT of all frames of a trajectory.
+
+        The remaining arguments are as in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Args:
+            orientations ((:math:`N_{frames}`, :math:`N_{points}`, 4) or (:math:`N_{frames}`, :math:`N_{points}`) :class:`numpy.ndarray`):
+                Orientations associated with the points of each frame. If the
+                array is two-dimensional, the values are treated as angles in
+                radians corresponding to **counterclockwise** rotations about
+                the z axis.
+        """  # noqa: E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        orientations = _gen_trajectory_angle_array(
+            orientations, n_frames, num_points)
+        cdef const float[::1] l_orientations = orientations
+
+        if reset:
+            self._reset()
+        self.pmftxytptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            <float*> &l_orientations[0], n_frames, num_points,
+            dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     def __repr__(self):
         bounds = self.bounds
         return ("freud.pmft.{cls}(x_max={x_max}, y_max={y_max}, "
@@ -442,6 +519,38 @@ cdef class PMFTXY(_PMFT):
                                   dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, query_orientations,
+                           neighbors=None, reset=True):
+        R"""Calculates the PMFT of all frames of a trajectory.
+
+        The remaining arguments are as in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Args:
+            query_orientations ((:math:`N_{frames}`, :math:`N_{points}`, 4) or (:math:`N_{frames}`, :math:`N_{points}`) :class:`numpy.ndarray`):
+                Orientations associated with the points of each frame. If the
+                array is two-dimensional, the values are treated as angles in
+                radians corresponding to **counterclockwise** rotations about
+                the z axis.
+        """  # noqa: E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        query_orientations = _gen_trajectory_angle_array(
+            query_orientations, n_frames, num_points)
+        cdef const float[::1] l_query_orientations = query_orientations
+
+        if reset:
+            self._reset()
+        self.pmftxyptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            <float*> &l_query_orientations[0], n_frames, num_points,
+            dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     @_Compute._computed_property
     def bin_counts(self):
         """:class:`numpy.ndarray`: The bin counts in the histogram."""
@@ -609,6 +718,51 @@ cdef class PMFTXYZ(_PMFT):
             dereference(qargs.thisptr))
         return self
 
+    def compute_trajectory(self, boxes, points, query_orientations,
+                           equiv_orientations=None, neighbors=None,
+                           reset=True):
+        R"""Calculates the PMFT of all frames of a trajectory.
+
+        The remaining arguments are as in
+        :meth:`freud.density.RDF.compute_trajectory`.
+
+        Args:
+            query_orientations ((:math:`N_{frames}`, :math:`N_{points}`, 4) :class:`numpy.ndarray`):
+                Orientations associated with the points of each frame.
+            equiv_orientations ((:math:`N_{faces}`, 4) :class:`numpy.ndarray`, optional):
+                Orientations to be treated as equivalent to account for
+                symmetry of the points, see :meth:`compute` (Default value =
+                :code:`None`).
+        """  # noqa: E501
+        cdef freud.locality._Trajectory trajectory = \
+            self._preprocess_trajectory(boxes, points, neighbors)
+        cdef unsigned int n_frames = trajectory.n_frames
+        cdef unsigned int num_points = trajectory.num_points
+
+        query_orientations = freud.util._convert_array(
+            query_orientations, shape=(n_frames, num_points, 4))
+        cdef const float[:, :, ::1] l_query_orientations = query_orientations
+
+        if equiv_orientations is None:
+            equiv_orientations = np.array([[1, 0, 0, 0]], dtype=np.float32)
+        else:
+            equiv_orientations = freud.util._convert_array(
+                equiv_orientations, shape=(None, 4))
+
+        cdef const float[:, ::1] l_equiv_orientations = equiv_orientations
+        cdef unsigned int num_equiv_orientations = \
+            l_equiv_orientations.shape[0]
+        if reset:
+            self._reset()
+        self.pmftxyzptr.accumulateTrajectory(
+            trajectory.boxes_ptr(), trajectory.points_ptr(),
+            <quat[float]*> &l_query_orientations[0, 0, 0],
+            n_frames, num_points,
+            <quat[float]*> &l_equiv_orientations[0, 0],
+            num_equiv_orientations, dereference(trajectory.qargs.thisptr))
+        self._called_compute = True
+        return self
+
     def __repr__(self):
         bounds = self.bounds
         return ("freud.pmft.{cls}(x_max={x_max}, y_max={y_max}, "
@@ -100,6 +100,73 @@ class TestCluster(unittest.TestCase):
         npt.assert_allclose(
             props.radii_of_gyration, [0, rg_2], rtol=1e-5, atol=1e-5)
 
+    def test_cluster_props_masses(self):
+        """Test mass-weighted moments against a per-cluster calculation"""
+        box, points = freud.data.make_random_system(10, 300, seed=0)
+        np.random.seed(0)
+        masses = np.random.rand(len(points)) + 0.5
+
+        clust = freud.cluster.Cluster()
+        clust.compute((box, points), neighbors={'r_max': 1.0})
+
+        props = freud.cluster.ClusterProperties()
+        props.compute((box, points), clust.cluster_idx, masses)
+        self._check_props(props, box, points, clust.cluster_idx, masses)
+
+        # Without masses every point has unit mass
+        props.compute((box, points), clust.cluster_idx)
+        npt.assert_equal(props.masses, props.sizes)
+
+    def test_cluster_props_large_cluster(self):
+        """Test clusters split between the blocks of the parallel reduction,
+        including one cluster holding most of the points."""
+        box = freud.box.Box.cube(10)
+        N = 20000
+        np.random.seed(1)
+        masses = np.random.rand(N) + 0.5
+        cluster_idx = np.random.randint(1, 200, size=N)
+        cluster_idx[np.random.rand(N) < 0.8] = 0
+        # Cluster 200 is empty
+        cluster_idx[-1] = 201
+        # Each cluster is a compact blob, which may cross the boundaries
+        centers = box.make_absolute(np.random.rand(202, 3))
+        points = box.wrap(
+            centers[cluster_idx] + np.random.normal(scale=0.5, size=(N, 3)))
+
+        props = freud.cluster.ClusterProperties()
+        props.compute((box, points), cluster_idx, masses)
+        npt.assert_equal(props.sizes, np.bincount(cluster_idx))
+        self._check_props(props, box, points, cluster_idx, masses, rtol=1e-5)
+
+    def _check_props(self, props, box, points, cluster_idx, masses,
+                     rtol=1e-7):
+        for i in np.unique(cluster_idx):
+            cluster_points = points[cluster_idx == i]
+            cluster_masses = masses[cluster_idx == i]
+            total_mass = np.sum(cluster_masses)
+            center = box.center_of_mass(cluster_points, cluster_masses)
+            deltas = box.wrap(cluster_points - center)
+            moments = np.einsum(
+                'n,ni,nj->ij', cluster_masses, deltas, deltas)
+            gyration = moments / total_mass
+            inertia = np.trace(moments) * np.eye(3) - moments
+
+            npt.assert_allclose(props.masses[i], total_mass, rtol=1e-5)
+            npt.assert_allclose(props.centers[i], center, atol=1e-5)
+            npt.assert_allclose(props.gyrations[i], gyration, rtol=rtol,
+                                atol=1e-4)
+            npt.assert_allclose(props.inertia_tensors[i], inertia,
+                                rtol=rtol, atol=1e-4)
+            npt.assert_allclose(props.radii_of_gyration[i],
+                                np.sqrt(np.trace(gyration)), atol=1e-4)
+            npt.assert_allclose(props.principal_moments[i],
+                                np.linalg.eigvalsh(gyration), rtol=rtol,
+                                atol=1e-4)
+            npt.assert_allclose(
+                props.bounding_boxes[i],
+                [center + np.min(deltas, axis=0),
+                 center + np.max(deltas, axis=0)], atol=1e-5)
+
     def test_cluster_com_periodic(self):
         "Tests center of mass for symmetric, box-spanning clusters."
         box = freud.Box.cube(3)
@@ -148,6 +215,35 @@ class TestCluster(unittest.TestCase):
 
         self.assertTrue(np.all(ckeys == check_values))
 
+    def test_flat_cluster_keys(self):
+        box, points = freud.data.make_random_system(10, 500, seed=0)
+        np.random.seed(0)
+        keys = np.random.randint(1000, size=len(points))
+
+        clust = freud.cluster.Cluster()
+        clust.compute((box, points), keys=keys, neighbors={'r_max': 0.8})
+
+        offsets = clust.cluster_key_offsets
+        flat_keys = clust.flat_cluster_keys
+        self.assertEqual(len(offsets), clust.num_clusters + 1)
+        self.assertEqual(offsets[0], 0)
+        self.assertEqual(offsets[-1], len(points))
+
+        # Clusters are ordered by decreasing size, then by their smallest
+        # point index, and store their keys in increasing point order.
+        sizes = np.diff(offsets)
+        npt.assert_equal(
+            sizes, np.bincount(clust.cluster_idx, minlength=len(sizes)))
+        min_ids = [np.min(np.where(clust.cluster_idx == i)[0])
+                   for i in range(clust.num_clusters)]
+        npt.assert_equal(
+            np.lexsort((min_ids, -sizes)), np.arange(clust.num_clusters))
+        for i in range(clust.num_clusters):
+            npt.assert_equal(flat_keys[offsets[i]:offsets[i+1]],
+                             keys[clust.cluster_idx == i])
+            npt.assert_equal(clust.cluster_keys[i],
+                             keys[clust.cluster_idx == i])
+
     def test_repr(self):
         clust = freud.cluster.Cluster()
         self.assertEqual(str(clust), str(eval(repr(clust))))
@@ -170,13 +266,80 @@ class TestCluster(unittest.TestCase):
         clust._repr_png_()
 
 
+class TestClusterTracker(unittest.TestCase):
+    def test_split_merge(self):
+        tracker = freud.cluster.ClusterTracker()
+        with self.assertRaises(AttributeError):
+            tracker.cluster_ids
+
+        tracker.compute([0, 0, 0, 0, 1, 1, 2, 2])
+        self.assertEqual(tracker.num_frames, 1)
+        npt.assert_equal(tracker.cluster_ids, [0, 1, 2])
+        self.assertEqual(tracker.overlaps.shape, (0, 3))
+
+        # Cluster 0 splits and clusters 1 and 2 merge
+        tracker.compute([0, 0, 0, 1, 2, 2, 2, 2])
+        self.assertEqual(tracker.num_frames, 2)
+        npt.assert_equal(tracker.overlaps,
+                         [[0, 0, 3], [0, 1, 1], [1, 2, 2], [2, 2, 2]])
+        npt.assert_equal(tracker.cluster_ids, [0, 3, 1])
+        npt.assert_equal(tracker.splits, [[0, 0], [0, 3]])
+        npt.assert_equal(tracker.merges, [[1, 1], [2, 1]])
+
+        # Relabeled clusters keep their ids
+        tracker.compute([2, 2, 2, 0, 1, 1, 1, 1])
+        npt.assert_equal(tracker.cluster_ids, [3, 1, 0])
+        self.assertEqual(len(tracker.splits), 0)
+        self.assertEqual(len(tracker.merges), 0)
+
+        with self.assertRaises(ValueError):
+            tracker.compute([0, 0, 1])
+
+        tracker.reset()
+        self.assertEqual(tracker.num_frames, 0)
+        tracker.compute([0, 1, 1])
+        npt.assert_equal(tracker.cluster_ids, [0, 1])
+
+    def test_random_overlaps(self):
+        box, points = freud.data.make_random_system(10, 500, seed=0)
+        clust = freud.cluster.Cluster()
+        tracker = freud.cluster.ClusterTracker()
+
+        clust.compute((box, points), neighbors={'r_max': 1.0})
+        prev_idx = np.copy(clust.cluster_idx)
+        tracker.compute(prev_idx)
+        prev_ids = np.copy(tracker.cluster_ids)
+
+        np.random.seed(0)
+        points = box.wrap(points + np.random.normal(scale=0.2,
+                                                    size=points.shape))
+        clust.compute((box, points), neighbors={'r_max': 1.0})
+        tracker.compute(clust.cluster_idx)
+
+        pairs, counts = np.unique(
+            np.stack([prev_idx, clust.cluster_idx], axis=1), axis=0,
+            return_counts=True)
+        npt.assert_equal(tracker.overlaps[:, :2], pairs)
+        npt.assert_equal(tracker.overlaps[:, 2], counts)
+
+        # Ids are unique, and continued ids come from the previous frame
+        ids = tracker.cluster_ids
+        self.assertEqual(len(np.unique(ids)), len(ids))
+        continued = ids < len(prev_ids)
+        self.assertTrue(np.all(np.isin(ids[continued], prev_ids)))
+
+    def test_repr(self):
+        tracker = freud.cluster.ClusterTracker()
+        self.assertEqual(str(tracker), str(eval(repr(tracker))))
+
+
 class TestClusterManagedArray(TestManagedArray, unittest.TestCase):
     def build_object(self):
         self.obj = freud.cluster.Cluster()
 
     @property
     def computed_properties(self):
-        return ['cluster_idx']
+        return ['cluster_idx', 'flat_cluster_keys']
 
     def compute(self):
         box = freud.box.Box.cube(10)
@@ -415,6 +415,27 @@ class TestCorrelationFunction(unittest.TestCase):
 
                 npt.assert_allclose(ocf.correlation, correct, atol=1e-6)
 
+    def test_compute_trajectory(self):
+        r_max = 2.5
+        bins = 20
+        n_frames = 3
+        np.random.seed(0)
+        systems = [freud.data.make_random_system(10, 200, seed=frame)
+                   for frame in range(n_frames)]
+        values = np.random.rand(n_frames, 200) + \
+            1j * np.random.rand(n_frames, 200)
+
+        frames = freud.density.CorrelationFunction(bins, r_max)
+        for system, frame_values in zip(systems, values):
+            frames.compute(system, frame_values, reset=False)
+        trajectory = freud.density.CorrelationFunction(bins, r_max)
+        trajectory.compute_trajectory([box for box, _ in systems],
+                                      [points for _, points in systems],
+                                      values)
+        npt.assert_equal(trajectory.bin_counts, frames.bin_counts)
+        npt.assert_allclose(trajectory.correlation, frames.correlation,
+                            rtol=1e-5)
+
 
 class TestCorrelationFunctionManagedArray(TestManagedArray, unittest.TestCase):
     def build_object(self):
@@ -178,6 +178,41 @@ class TestRDF(unittest.TestCase):
             np.array([0], dtype=np.float32), bins=bins, range=[r_min, r_max])
         npt.assert_allclose(rdf.bin_edges, expected_bin_edges, atol=1e-6)
 
+    def test_compute_trajectory(self):
+        r_max = 2.5
+        bins = 20
+        n_frames = 5
+        systems = [freud.data.make_random_system(10 + 0.5*frame, 200,
+                                                 seed=frame)
+                   for frame in range(n_frames)]
+        boxes = [box for box, _ in systems]
+        points = [frame_points for _, frame_points in systems]
+
+        frames = freud.density.RDF(bins, r_max)
+        for system in systems:
+            frames.compute(system, reset=False)
+        trajectory = freud.density.RDF(bins, r_max)
+        trajectory.compute_trajectory(boxes, points)
+        npt.assert_equal(trajectory.bin_counts, frames.bin_counts)
+        npt.assert_allclose(trajectory.rdf, frames.rdf)
+        npt.assert_allclose(trajectory.n_r, frames.n_r)
+
+        # A single box is used for all frames.
+        single = freud.density.RDF(bins, r_max)
+        single.compute_trajectory(boxes[0], [points[0]] * 2)
+        frames.compute(systems[0])
+        npt.assert_equal(single.bin_counts, 2*frames.bin_counts)
+
+        with self.assertRaises(ValueError):
+            trajectory.compute_trajectory(
+                boxes, points, neighbors=freud.locality.AABBQuery(
+                    *systems[0]).query(points[0], {'r_max': r_max})
+                .toNeighborList())
+        with self.assertRaises(ValueError):
+            trajectory.compute_trajectory(boxes[:0], np.zeros((0, 10, 3)))
+        with self.assertRaises(ValueError):
+            trajectory.compute_trajectory(boxes, np.zeros((n_frames, 0, 3)))
+
 
 class TestRDFManagedArray(TestManagedArray, unittest.TestCase):
     def build_object(self):
@@ -4,6 +4,27 @@ import freud
 import unittest
 
 
+def quat_multiply(a, b):
+    """Multiply arrays of quaternions with broadcasting."""
+    s = a[..., 0]*b[..., 0] - np.sum(a[..., 1:]*b[..., 1:], axis=-1)
+    v = (a[..., :1]*b[..., 1:] + b[..., :1]*a[..., 1:] +
+         np.cross(a[..., 1:], b[..., 1:]))
+    return np.concatenate([s[..., np.newaxis], v], axis=-1)
+
+
+def quat_conj(q):
+    return q*np.array([1, -1, -1, -1])
+
+
+def min_separation_angle(ref_q, q, equiv_qs):
+    """Reference implementation testing every equivalent orientation."""
+    q_temp = quat_multiply(q, quat_conj(equiv_qs[0]))
+    candidates = np.concatenate(
+        [q[np.newaxis], quat_multiply(q_temp, equiv_qs)])
+    cos_half = np.sum(candidates*ref_q, axis=-1)
+    return np.min(2*np.arccos(np.clip(cos_half, -1, 1)))
+
+
 class TestAngularSeparationGlobal(unittest.TestCase):
     def test_getN(self):
         boxlen = 10
@@ -49,6 +70,25 @@ class TestAngularSeparationGlobal(unittest.TestCase):
                 npt.assert_allclose(ang.angles[i][j], np.pi/16,
                                     atol=1e-6)
 
+    def test_random_equivalent_orientations(self):
+        np.random.seed(0)
+
+        def random_quats(n):
+            q = np.random.normal(size=(n, 4))
+            return q/np.linalg.norm(q, axis=1)[:, np.newaxis]
+
+        global_ors = random_quats(5)
+        ors = random_quats(20)
+        equiv = random_quats(12)
+        equiv = np.concatenate([equiv, -equiv])
+
+        ang = freud.environment.AngularSeparationGlobal()
+        ang.compute(global_ors, ors, equiv)
+        expected = np.array(
+            [[min_separation_angle(q, g, equiv) for g in global_ors]
+             for q in ors])
+        npt.assert_allclose(ang.angles, expected, atol=2e-3)
+
     def test_repr(self):
         ang = freud.environment.AngularSeparationGlobal()
         self.assertEqual(str(ang), str(eval(repr(ang))))
@@ -129,6 +129,30 @@ class TestBondOrder(unittest.TestCase):
             self.assertEqual(np.count_nonzero(bod.bond_order), 12)
             self.assertEqual(len(np.unique(bod.bond_order)), 2)
 
+    def test_compute_trajectory(self):
+        n_frames = 3
+        N = 100
+        np.random.seed(0)
+        systems = [freud.data.make_random_system(10, N, seed=frame)
+                   for frame in range(n_frames)]
+        orientations = rowan.random.rand(n_frames * N).reshape(n_frames, N, 4)
+        neighbors = {'num_neighbors': 6, 'exclude_ii': True}
+
+        for mode in ['bod', 'lbod', 'obcd', 'oocd']:
+            frames = freud.environment.BondOrder((10, 12), mode=mode)
+            for system, frame_orientations in zip(systems, orientations):
+                frames.compute(system, frame_orientations,
+                               neighbors=neighbors, reset=False)
+            trajectory = freud.environment.BondOrder((10, 12), mode=mode)
+            trajectory.compute_trajectory(
+                [box for box, _ in systems],
+                [points for _, points in systems], orientations,
+                neighbors=neighbors)
+            np.testing.assert_equal(trajectory.bin_counts,
+                                    frames.bin_counts)
+            np.testing.assert_allclose(trajectory.bond_order,
+                                       frames.bond_order, rtol=1e-5)
+
 
 class TestBondOrderManagedArray(TestManagedArray, unittest.TestCase):
     def build_object(self):
@@ -148,6 +148,39 @@ class TestLocalBondProjection(unittest.TestCase):
         npt.assert_allclose(ang.projections[2], 1.5, atol=1e-6)
         npt.assert_allclose(ang.normed_projections[2], 1, atol=1e-6)
 
+    def test_random_equivalent_orientations(self):
+        np.random.seed(0)
+        box, points = freud.data.make_random_system(5, 30, seed=0)
+        ors = np.random.normal(size=(30, 4))
+        ors /= np.linalg.norm(ors, axis=1)[:, np.newaxis]
+        equiv_quats = np.random.normal(size=(6, 4))
+        equiv_quats /= np.linalg.norm(equiv_quats, axis=1)[:, np.newaxis]
+        proj_vecs = np.random.normal(size=(4, 3))
+        query_args = dict(num_neighbors=4, exclude_ii=True)
+
+        ang = freud.environment.LocalBondProjection()
+        ang.compute((box, points), ors, proj_vecs, None, equiv_quats,
+                    query_args)
+
+        # Compare against rotating each projection vector by every
+        # equivalent orientation for every bond
+        nlist = ang.nlist
+        bonds = box.wrap(points[nlist.point_indices] -
+                         points[nlist.query_point_indices])
+        local_bonds = rowan.rotate(
+            rowan.conjugate(ors[nlist.point_indices]), bonds)
+        qtests = rowan.multiply(rowan.conjugate(equiv_quats[0]), equiv_quats)
+        equiv_vecs = np.concatenate(
+            [proj_vecs[np.newaxis],
+             rowan.rotate(qtests[:, np.newaxis], proj_vecs[np.newaxis])])
+        expected = np.max(
+            np.einsum('bi,eki->bke', local_bonds, equiv_vecs), axis=-1)
+        npt.assert_allclose(ang.projections, expected, atol=1e-5)
+        npt.assert_allclose(
+            ang.normed_projections,
+            expected / np.linalg.norm(local_bonds, axis=1)[:, np.newaxis],
+            atol=1e-5)
+
     def test_repr(self):
         ang = freud.environment.LocalBondProjection()
         self.assertEqual(str(ang), str(eval(repr(ang))))
@@ -199,6 +199,51 @@ class TestLocalDescriptors(unittest.TestCase):
     def test_repr(self):
         comp = freud.environment.LocalDescriptors(8, True)
         self.assertEqual(str(comp), str(eval(repr(comp))))
+        comp = freud.environment.LocalDescriptors(
+            8, True, output='power_spectrum')
+        self.assertEqual(str(comp), str(eval(repr(comp))))
+
+    def test_power_spectrum(self):
+        N = 100
+        l_max = 6
+        box, positions = freud.data.make_random_system(10, N, seed=0)
+        neighbors = dict(num_neighbors=8, exclude_ii=True)
+
+        ld = freud.environment.LocalDescriptors(l_max, mode='global')
+        ld.compute((box, positions), neighbors=neighbors)
+        nlist = ld.nlist
+
+        # Sum the bond harmonics of each point, with negative m included
+        sums = np.zeros((N, ld.sph.shape[1]), dtype=np.complex128)
+        np.add.at(sums, nlist.query_point_indices, ld.sph)
+        expected = np.zeros((N, l_max + 1))
+        col = 0
+        for l in range(l_max + 1):
+            width = 2*l + 1
+            expected[:, l] = np.sum(
+                np.abs(sums[:, col:col + width])**2, axis=1)
+            col += width
+
+        ps = freud.environment.LocalDescriptors(
+            l_max, mode='global', output='power_spectrum')
+        ps.compute((box, positions), neighbors=neighbors)
+        self.assertEqual(ps.power_spectrum.shape, (N, l_max + 1))
+        npt.assert_allclose(ps.power_spectrum, expected, rtol=1e-4,
+                            atol=1e-5)
+        with self.assertRaises(AttributeError):
+            ps.sph
+        with self.assertRaises(AttributeError):
+            ld.power_spectrum
+
+        # The power spectrum does not depend on the orientation mode
+        ps_local = freud.environment.LocalDescriptors(
+            l_max, mode='neighborhood', output='power_spectrum')
+        ps_local.compute((box, positions), neighbors=neighbors)
+        npt.assert_allclose(ps_local.power_spectrum, ps.power_spectrum,
+                            rtol=1e-4, atol=1e-5)
+
+        with self.assertRaises(ValueError):
+            freud.environment.LocalDescriptors(l_max, output='bispectrum')
 
     def test_ql(self):
         """Check if we can reproduce Steinhardt ql."""
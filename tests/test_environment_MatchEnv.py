@@ -233,6 +233,73 @@ class TestCluster(unittest.TestCase):
         npt.assert_equal(len(returnResult[1]), num_neighbors,
                          err_msg="two environments are not similar")
 
+    def test_global_search_exhaustive(self):
+        # Perturb part of a simple cubic crystal so that there are many
+        # distinct environments, and compare the clusters from the global
+        # search against an exhaustive pairwise comparison.
+        box, points = freud.data.UnitCell.sc().generate_system(4, scale=2)
+        np.random.seed(0)
+        points[::3] += np.random.uniform(-0.4, 0.4, size=points[::3].shape)
+        points = box.wrap(points)
+        threshold = 0.2
+
+        match = freud.environment.EnvironmentCluster()
+        match.compute((box, points), threshold, global_search=True,
+                      neighbors=dict(num_neighbors=6))
+        envs = match.point_environments
+
+        labels = np.arange(len(points))
+        for i in range(len(points)):
+            for j in range(i + 1, len(points)):
+                _, vec_map = freud.environment._is_similar_motif(
+                    box, envs[i], envs[j], threshold)
+                if len(vec_map) == len(envs[i]):
+                    labels[labels == labels[j]] = labels[i]
+
+        # Both labelings must describe the same partition of the points
+        _, expected = np.unique(labels, return_inverse=True)
+        _, computed = np.unique(match.cluster_idx, return_inverse=True)
+        pairs = set(zip(expected, computed))
+        self.assertEqual(len(pairs), len(set(expected)))
+        self.assertEqual(len(pairs), len(set(computed)))
+        self.assertGreater(match.num_clusters, 1)
+
+    def test_deterministic(self):
+        # Matches are found in parallel but merged in a fixed order, so
+        # repeated computations must give identical results.
+        box, points = freud.data.UnitCell.fcc().generate_system(4, scale=2)
+        np.random.seed(1)
+        points[::4] += np.random.uniform(-0.1, 0.1, size=points[::4].shape)
+        points = box.wrap(points)
+        for global_search in [False, True]:
+            match = freud.environment.EnvironmentCluster()
+            match.compute((box, points), 0.1, global_search=global_search,
+                          neighbors=dict(num_neighbors=12))
+            cluster_idx = np.copy(match.cluster_idx)
+            point_environments = np.copy(match.point_environments)
+            for _ in range(3):
+                match.compute((box, points), 0.1,
+                              global_search=global_search,
+                              neighbors=dict(num_neighbors=12))
+                npt.assert_equal(match.cluster_idx, cluster_idx)
+                npt.assert_equal(match.point_environments,
+                                 point_environments)
+
+    def test_point_environments_ordered(self):
+        # In a perfect crystal all environments match, and every particle's
+        # environment vectors must be ordered like those of the cluster.
+        box, points = freud.data.UnitCell.fcc().generate_system(4)
+        for global_search in [False, True]:
+            match = freud.environment.EnvironmentCluster()
+            match.compute((box, points), 0.1, global_search=global_search,
+                          neighbors=dict(num_neighbors=12))
+            self.assertEqual(match.num_clusters, 1)
+            cluster_env = np.asarray(match.cluster_environments[0])
+            npt.assert_allclose(
+                match.point_environments,
+                np.broadcast_to(cluster_env, match.point_environments.shape),
+                atol=1e-5)
+
     # Test EnvironmentCluster._minimize_RMSD and registration functionality.
     # Overkill? Maybe.
     def test_minimize_RMSD(self):
@@ -342,6 +409,19 @@ class TestCluster(unittest.TestCase):
             e0, refPoints2[np.asarray(list(isSim_vec_map.values()))],
             atol=1e-5)
 
+    def test_minimize_RMSD_optimal_assignment(self):
+        # Assigning each point to its nearest unused reference point in turn
+        # would pair (1.4, 0, 0) with (1, 0, 0), but the optimal assignment
+        # pairs it with (1.9, 0, 0).
+        box = freud.box.Box.cube(10)
+        ref_points = np.array([[1, 0, 0], [1.9, 0, 0]], dtype=np.float32)
+        points = np.array([[1.4, 0, 0], [0.9, 0, 0]], dtype=np.float32)
+        min_rmsd, _, vec_map = freud.environment._minimize_RMSD(
+            box, ref_points, points, registration=False)
+        npt.assert_allclose(min_rmsd, np.sqrt((0.5**2 + 0.1**2)/2),
+                            rtol=1e-5)
+        self.assertEqual(vec_map, {0: 1, 1: 0})
+
     def test_repr(self):
         match = freud.environment.EnvironmentCluster()
         self.assertEqual(str(match), str(eval(repr(match))))
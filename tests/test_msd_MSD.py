@@ -2,6 +2,8 @@ import numpy as np
 import numpy.testing as npt
 import freud
 import matplotlib
+import os
+import tempfile
 import unittest
 matplotlib.use('agg')
 
@@ -78,6 +80,75 @@ class TestMSD(unittest.TestCase):
             npt.assert_allclose(solution, simple, atol=1e-6)
             npt.assert_allclose(solution_particle, simple_particle, atol=1e-5)
 
+    def test_unwrap(self):
+        """Test that images are used to unwrap positions with the box."""
+        box = freud.box.Box(2, 3, 4, 0.1, 0.2, 0.3)
+        np.random.seed(0)
+        images = np.random.randint(-3, 4, size=(20, 5, 3)).astype(np.int32)
+        positions = box.wrap(
+            np.random.rand(20, 5, 3).reshape(-1, 3) * 4).reshape(20, 5, 3)
+        unwrapped = np.array(
+            [box.unwrap(p, i) for p, i in zip(positions, images)])
+        for mode in ['window', 'direct']:
+            msd = freud.msd.MSD(box, mode=mode)
+            npt.assert_allclose(
+                msd.compute(positions, images).particle_msd,
+                freud.msd.MSD(mode=mode).compute(unwrapped).particle_msd,
+                rtol=1e-5, atol=1e-3)
+            # Images are ignored without a box.
+            npt.assert_allclose(
+                freud.msd.MSD(mode=mode).compute(
+                    positions, images).particle_msd,
+                freud.msd.MSD(mode=mode).compute(positions).particle_msd)
+
+    def test_chunk_size(self):
+        """Test that computing particles in chunks gives the same result."""
+        box = freud.box.Box.cube(5)
+        np.random.seed(1)
+        positions = np.random.rand(15, 11, 3).astype(np.float32)
+        images = np.random.randint(-2, 3, size=(15, 11, 3)).astype(np.int32)
+        for mode in ['window', 'direct']:
+            msd = freud.msd.MSD(box, mode=mode)
+            expected = msd.compute(positions, images).particle_msd.copy()
+            for chunk_size in [1, 4, 11, 20]:
+                npt.assert_allclose(
+                    msd.compute(positions, images,
+                                chunk_size=chunk_size).particle_msd,
+                    expected, rtol=1e-6, atol=1e-6)
+
+            # Chunks of a memory-mapped trajectory are read as needed.
+            with tempfile.TemporaryDirectory() as tmpdir:
+                filename = os.path.join(tmpdir, 'positions.dat')
+                memmap = np.memmap(filename, dtype=np.float32, mode='w+',
+                                   shape=positions.shape)
+                memmap[:] = positions
+                memmap.flush()
+                memmap = np.memmap(filename, dtype=np.float32, mode='r',
+                                   shape=positions.shape)
+                npt.assert_allclose(
+                    msd.compute(memmap, images, chunk_size=3).particle_msd,
+                    expected, rtol=1e-6, atol=1e-6)
+                del memmap
+
+            # Only the running sum is kept without the per-particle MSD.
+            expected_msd = expected.mean(axis=1)
+            msd.compute(positions, images, chunk_size=4,
+                        keep_particle_msd=False)
+            npt.assert_allclose(msd.msd, expected_msd, rtol=1e-6, atol=1e-6)
+            with self.assertRaises(AttributeError):
+                msd.particle_msd
+            msd.compute(positions[:, :5], images[:, :5],
+                        keep_particle_msd=False)
+            msd.compute(positions[:, 5:], images[:, 5:], reset=False)
+            npt.assert_allclose(msd.msd, expected_msd, rtol=1e-6, atol=1e-6)
+            with self.assertRaises(AttributeError):
+                msd.particle_msd
+
+        with self.assertRaises(ValueError):
+            msd.compute(positions, chunk_size=0)
+        with self.assertRaises(ValueError):
+            msd.compute(positions[:-1], reset=False)
+
     def test_repr(self):
         msd = freud.msd.MSD()
         self.assertEqual(str(msd), str(eval(repr(msd))))
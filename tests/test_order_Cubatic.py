@@ -129,9 +129,85 @@ class TestCubatic(unittest.TestCase):
                 scale=0,
                 n_replicates=10)
 
+    def test_gradient_optimizer(self):
+        N = 1000
+        np.random.seed(0)
+        # small random rotations about random axes, then a global rotation
+        axes = np.random.normal(size=(N, 3))
+        axes /= np.linalg.norm(axes, axis=-1)[:, np.newaxis]
+        angles = np.random.uniform(low=0.0, high=0.2, size=N)
+        global_rotation = rowan.random.rand(1)
+        orientations = rowan.multiply(
+            global_rotation, rowan.from_axis_angle(axes, angles))
+
+        annealing = freud.order.Cubatic(5.0, 0.001, 0.95, 10, seed=0)
+        annealing.compute(orientations)
+        gradient = freud.order.Cubatic(
+            5.0, 0.001, 0.95, 10, optimizer='gradient')
+        gradient.compute(orientations)
+        self.assertEqual(gradient.optimizer, 'gradient')
+
+        self.assertGreater(gradient.order, annealing.order - 1e-3)
+        self.assertGreater(np.mean(gradient.particle_order),
+                           np.mean(annealing.particle_order) - 1e-3)
+
+        # The result must not depend on the seed
+        other = freud.order.Cubatic(
+            5.0, 0.001, 0.95, 1, seed=12345, optimizer='gradient')
+        other.compute(orientations)
+        npt.assert_allclose(other.order, gradient.order, rtol=1e-6)
+        npt.assert_allclose(other.cubatic_tensor, gradient.cubatic_tensor,
+                            atol=1e-6)
+
+        with self.assertRaises(ValueError):
+            freud.order.Cubatic(5.0, 0.001, 0.95, optimizer='newton')
+
+    def test_lazy_particle_order(self):
+        np.random.seed(0)
+        orientations = rowan.random.rand(100)
+        cubatic = freud.order.Cubatic(
+            5.0, 0.001, 0.95, optimizer='gradient')
+        cubatic.compute(orientations)
+        order = cubatic.order
+        global_tensor = cubatic.global_tensor
+
+        # The global tensor is the average of the per-particle tensors
+        vectors = np.stack([rowan.rotate(orientations, v)
+                            for v in np.eye(3)], axis=1)
+        expected = 2 * np.einsum('nvi,nvj,nvk,nvl->ijkl', vectors,
+                                 vectors, vectors, vectors) / 100
+        delta = np.eye(3)
+        r4 = (np.einsum('ij,kl->ijkl', delta, delta) +
+              np.einsum('ik,jl->ijkl', delta, delta) +
+              np.einsum('il,jk->ijkl', delta, delta)) * 2 / 5
+        npt.assert_allclose(global_tensor, expected - r4, atol=1e-5)
+
+        # Per-particle values are computed on request after a new compute
+        cubatic.compute(orientations[:50])
+        self.assertEqual(cubatic.particle_order.shape, (50,))
+        particle_order = cubatic.particle_order
+        cubatic.compute(orientations)
+        self.assertAlmostEqual(cubatic.order, order, places=5)
+        self.assertEqual(cubatic.particle_order.shape, (100,))
+        self.assertFalse(np.array_equal(particle_order,
+                                        cubatic.particle_order[:50]))
+
+        # Reusing the input buffer after compute does not change the result
+        buffer = orientations.astype(np.float32)
+        cubatic.compute(buffer)
+        expected_order = cubatic.order
+        buffer[:] = rowan.random.rand(100)
+        expected = freud.order.Cubatic(
+            5.0, 0.001, 0.95, optimizer='gradient').compute(
+                orientations.astype(np.float32)).particle_order
+        self.assertEqual(cubatic.order, expected_order)
+        npt.assert_allclose(cubatic.particle_order, expected, atol=1e-5)
+
     def test_repr(self):
         cubatic = freud.order.Cubatic(5.0, 0.001, 0.95, 10)
         self.assertEqual(str(cubatic), str(eval(repr(cubatic))))
+        cubatic = freud.order.Cubatic(5.0, 0.001, 0.95, optimizer='gradient')
+        self.assertEqual(str(cubatic), str(eval(repr(cubatic))))
 
 
 if __name__ == '__main__':
@@ -173,6 +173,52 @@ class TestHexatic(unittest.TestCase):
             npt.assert_allclose(
                 psi_k_weighted, hop_weighted.particle_order[0], atol=1e-5)
 
+    def test_multiple_k(self):
+        box, points = freud.data.make_random_system(
+            10, 200, is2D=True, seed=0)
+        k_values = [6, 4, 5, 0, 12]
+        hop = freud.order.Hexatic(k_values, weighted=True)
+        self.assertEqual(hop.k, k_values)
+        self.assertEqual(hop.default_query_args['num_neighbors'], 12)
+
+        # Build a neighbor list with arbitrary weights
+        query_nlist = freud.locality.AABBQuery(box, points).query(
+            points, dict(num_neighbors=8, exclude_ii=True)).toNeighborList()
+        np.random.seed(0)
+        nlist = freud.locality.NeighborList.from_arrays(
+            len(points), len(points), query_nlist.query_point_indices,
+            query_nlist.point_indices, query_nlist.distances,
+            np.random.uniform(0.5, 1.5, len(query_nlist)))
+
+        hop.compute((box, points), neighbors=nlist)
+        self.assertEqual(hop.particle_order.shape, (200, len(k_values)))
+
+        for i, k in enumerate(k_values):
+            single = freud.order.Hexatic(k, weighted=True)
+            single.compute((box, points), neighbors=nlist)
+            npt.assert_allclose(hop.particle_order[:, i],
+                                single.particle_order, atol=1e-5)
+        npt.assert_allclose(hop.particle_order[:, 3], 1, atol=1e-6)
+
+        # Multiple k also work with a query
+        hop = freud.order.Hexatic([4, 6])
+        hop.compute((box, points))
+        single = freud.order.Hexatic(6)
+        single.compute((box, points), neighbors=dict(num_neighbors=6))
+        npt.assert_allclose(hop.particle_order[:, 1],
+                            single.particle_order, atol=1e-5)
+
+        # A sequence with a single k keeps the k axis.
+        hop = freud.order.Hexatic([6])
+        self.assertEqual(hop.k, [6])
+        hop.compute((box, points), neighbors=dict(num_neighbors=6))
+        self.assertEqual(hop.particle_order.shape, (200, 1))
+        npt.assert_allclose(hop.particle_order[:, 0],
+                            single.particle_order, atol=1e-5)
+
+        with self.assertRaises(ValueError):
+            freud.order.Hexatic([])
+
     def test_3d_box(self):
         boxlen = 10
         N = 500
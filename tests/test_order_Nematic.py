@@ -96,6 +96,31 @@ class TestNematicOrder(unittest.TestCase):
         self.assertFalse(np.all(
             op_perp.nematic_tensor == np.diag([-0.5, 1, -0.5])))
 
+    def test_particle_tensor(self):
+        N = 1000
+        np.random.seed(0)
+        orientations = rowan.random.rand(N)
+        u = np.array([0, 0, 1])
+        op = freud.order.Nematic(u)
+        op.compute(orientations[:N // 2])
+        op.compute(orientations)
+
+        directors = rowan.rotate(orientations, u)
+        expected = 1.5 * np.einsum('ni,nj->nij', directors, directors) - \
+            0.5 * np.eye(3)
+        npt.assert_allclose(op.nematic_tensor, np.mean(expected, axis=0),
+                            atol=1e-6)
+        self.assertEqual(op.particle_tensor.shape, (N, 3, 3))
+        npt.assert_allclose(op.particle_tensor, expected, atol=1e-6)
+        npt.assert_allclose(op.nematic_tensor,
+                            np.mean(op.particle_tensor, axis=0), atol=1e-6)
+
+        # Reusing the input buffer after compute does not change the result
+        buffer = orientations.astype(np.float32)
+        op.compute(buffer)
+        buffer[:] = rowan.random.rand(N)
+        npt.assert_allclose(op.particle_tensor, expected, atol=1e-5)
+
     def test_repr(self):
         u = np.array([1, 0, 0])
         op = freud.order.Nematic(u)
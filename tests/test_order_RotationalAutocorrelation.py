@@ -160,6 +160,38 @@ class TestRotationalAutocorrelationReference(unittest.TestCase):
                 return_correlation(l, ref_orientations, orientations),
                 atol=1e-6, rtol=1e-6)
 
+    def test_trajectory(self):
+        """Compare the multi-lag mode to averages of single frame pairs."""
+        np.random.seed(0)
+        n_frames, N = 7, 5
+        orientations = rowan.random.rand(n_frames * N).reshape(
+            n_frames, N, 4)
+        # Identity orientations have xi = 0 in the harmonics
+        orientations[::2, 0] = [1, 0, 0, 0]
+
+        for l in [0, 2, 6, 8, 22]:
+            ra = freud.order.RotationalAutocorrelation(l)
+            with self.assertRaises(AttributeError):
+                ra.lag_order
+            ra.compute_trajectory(orientations)
+            self.assertEqual(ra.lag_order.shape, (n_frames,))
+            npt.assert_allclose(ra.lag_order[0], 1, rtol=1e-5)
+
+            pair_ra = freud.order.RotationalAutocorrelation(l)
+            expected = [np.mean([
+                pair_ra.compute(orientations[t], orientations[t + lag]).order
+                for t in range(n_frames - lag)]) for lag in range(n_frames)]
+            npt.assert_allclose(ra.lag_order, expected, atol=1e-5)
+
+    def test_large_l(self):
+        """Values stay finite and bounded beyond the range of integer
+        factorials."""
+        np.random.seed(0)
+        orientations = rowan.random.rand(10)
+        ra = freud.order.RotationalAutocorrelation(16)
+        npt.assert_allclose(
+            ra.compute(orientations, orientations).order, 1, rtol=1e-5)
+
 
 if __name__ == '__main__':
     unittest.main()
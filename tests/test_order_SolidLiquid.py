@@ -87,6 +87,32 @@ class TestSolidLiquid(unittest.TestCase):
         comp.ql_ij
         comp._repr_png_()
 
+    def test_sweep_thresholds(self):
+        """Check threshold sweeps against separate computes."""
+        box, positions = freud.data.UnitCell.fcc().generate_system(
+            4, scale=2, sigma_noise=0.15, seed=0)
+        query_args = dict(num_neighbors=12)
+        q_thresholds = [0.3, 0.5, 0.7, 0.7, 0.9]
+        solid_thresholds = [4, 6, 6, 8, 10]
+
+        comp = freud.order.SolidLiquid(6, q_threshold=.7, solid_threshold=6)
+        with self.assertRaises(AttributeError):
+            comp.sweep_thresholds(q_thresholds, solid_thresholds)
+        comp.compute((box, positions), neighbors=query_args)
+        cluster_idx = comp.cluster_idx.copy()
+        sizes = comp.sweep_thresholds(q_thresholds, solid_thresholds)
+        npt.assert_array_equal(comp.cluster_idx, cluster_idx)
+
+        for q_threshold, solid_threshold, size in zip(
+                q_thresholds, solid_thresholds, sizes):
+            single = freud.order.SolidLiquid(
+                6, q_threshold=q_threshold, solid_threshold=solid_threshold)
+            single.compute((box, positions), neighbors=query_args)
+            self.assertEqual(size, single.largest_cluster_size)
+
+        with self.assertRaises(ValueError):
+            comp.sweep_thresholds([0.5, 0.7], [6])
+
     def test_repr(self):
         comp = freud.order.SolidLiquid(6, q_threshold=.7, solid_threshold=6)
         self.assertEqual(str(comp), str(eval(repr(comp))))
@@ -317,6 +317,82 @@ class TestSteinhardt(unittest.TestCase):
         assert np.all(np.isnan(comp.particle_order))
         npt.assert_allclose(np.nan_to_num(comp.particle_order), 0)
 
+    def test_multiple_l(self):
+        """Ensure that computing multiple l at once matches separate runs."""
+        box, positions = freud.data.UnitCell.fcc().generate_system(
+            4, sigma_noise=0.05, seed=0)
+        ls = [4, 6, 8, 10, 12]
+        neighbors = {'num_neighbors': 12}
+
+        for average in [False, True]:
+            for wl in [False, True]:
+                comp = freud.order.Steinhardt(
+                    ls, average=average, wl=wl, wl_normalize=wl)
+                comp.compute((box, positions), neighbors=neighbors)
+                self.assertEqual(comp.l, ls)
+                npt.assert_equal(comp.particle_order.shape,
+                                 (len(positions), len(ls)))
+                npt.assert_equal(comp.ql.shape, (len(positions), len(ls)))
+                npt.assert_equal(len(comp.order), len(ls))
+                self.assertEqual(len(comp.particle_harmonics), len(ls))
+
+                for l_index, sph_l in enumerate(ls):
+                    single = freud.order.Steinhardt(
+                        sph_l, average=average, wl=wl, wl_normalize=wl)
+                    single.compute((box, positions), neighbors=neighbors)
+                    npt.assert_allclose(comp.particle_order[:, l_index],
+                                        single.particle_order,
+                                        rtol=1e-5, atol=1e-6)
+                    npt.assert_allclose(comp.ql[:, l_index], single.ql,
+                                        rtol=1e-5, atol=1e-6)
+                    npt.assert_allclose(comp.order[l_index], single.order,
+                                        rtol=1e-5, atol=1e-6)
+                    npt.assert_equal(comp.particle_harmonics[l_index].shape,
+                                     (len(positions), 2 * sph_l + 1))
+                    npt.assert_allclose(comp.particle_harmonics[l_index],
+                                        single.particle_harmonics,
+                                        rtol=1e-5, atol=1e-6)
+
+        # A sequence with a single l keeps the axis over l.
+        comp = freud.order.Steinhardt([6])
+        comp.compute((box, positions), neighbors=neighbors)
+        self.assertEqual(comp.l, [6])
+        npt.assert_equal(comp.particle_order.shape, (len(positions), 1))
+        npt.assert_equal(comp.ql.shape, (len(positions), 1))
+        npt.assert_equal(comp.order.shape, (1,))
+        self.assertEqual(len(comp.particle_harmonics), 1)
+        self.assertEqual(str(comp), str(eval(repr(comp))))
+
+    @util.skipIfMissing('sympy.physics.wigner')
+    def test_wl_large_l(self):
+        """Check wl beyond l = 20 against Wigner 3j symbols from sympy."""
+        from sympy.physics.wigner import wigner_3j
+        box, positions = freud.data.make_random_system(5, 20, seed=0)
+        sph_l = 22
+
+        comp = freud.order.Steinhardt(sph_l, wl=True)
+        comp.compute((box, positions), neighbors={'num_neighbors': 8})
+
+        def lm_index(m):
+            return m if m >= 0 else sph_l - m
+
+        qlm = comp.particle_harmonics
+        wl = np.zeros(len(positions))
+        for m1 in range(-sph_l, sph_l+1):
+            for m2 in range(max(-sph_l-m1, -sph_l), min(sph_l-m1, sph_l)+1):
+                m3 = -m1 - m2
+                coefficient = float(
+                    wigner_3j(sph_l, sph_l, sph_l, m1, m2, m3))
+                wl += np.real(coefficient * qlm[:, lm_index(m1)] *
+                              qlm[:, lm_index(m2)] * qlm[:, lm_index(m3)])
+        npt.assert_allclose(comp.particle_order, wl, rtol=1e-4, atol=1e-6)
+
+        # Odd l third-order invariants vanish identically.
+        comp = freud.order.Steinhardt([23, 32], wl=True)
+        comp.compute((box, positions), neighbors={'num_neighbors': 8})
+        npt.assert_equal(comp.particle_order[:, 0], 0)
+        self.assertTrue(np.all(np.isfinite(comp.particle_order[:, 1])))
+
 
 if __name__ == '__main__':
     unittest.main()
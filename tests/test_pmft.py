@@ -112,6 +112,76 @@ class TestPMFT:
         pmft.pmft
         pmft.box
 
+    def test_tile_size(self):
+        """Tiled histograms must give the same results as dense ones."""
+        system = freud.data.make_random_system(
+            self.L, 200, self.ndim == 2, seed=0)
+        np.random.seed(0)
+        orientations = rowan.random.rand(200) if self.ndim == 3 else \
+            np.random.rand(200)*2*np.pi
+
+        dense = self.make_pmft()
+        self.assertEqual(dense.tile_size, 0)
+        tiled = self.make_pmft()
+        tiled.tile_size = 64
+        self.assertEqual(tiled.tile_size, 64)
+        with self.assertRaises(AttributeError):
+            tiled.bin_counts
+
+        for _ in range(2):
+            dense.compute(system, orientations, reset=False)
+            tiled.compute(system, orientations, reset=False)
+        npt.assert_equal(tiled.bin_counts, dense.bin_counts)
+        npt.assert_allclose(tiled.pmft, dense.pmft)
+
+        tiled.compute(system, orientations)
+        dense.compute(system, orientations)
+        npt.assert_equal(tiled.bin_counts, dense.bin_counts)
+
+        with self.assertRaises(ValueError):
+            tiled.tile_size = -1
+
+    def test_compute_trajectory(self):
+        """A trajectory must give the same results as its frames."""
+        n_frames, N = 4, 100
+        np.random.seed(0)
+        boxes = []
+        points = []
+        orientations = []
+        for frame in range(n_frames):
+            box, frame_points = freud.data.make_random_system(
+                self.L + frame, N, self.ndim == 2, seed=frame)
+            boxes.append(box)
+            points.append(frame_points)
+            orientations.append(rowan.random.rand(N) if self.ndim == 3 else
+                                np.random.rand(N)*2*np.pi)
+
+        frames = self.make_pmft()
+        for box, frame_points, frame_orientations in zip(
+                boxes, points, orientations):
+            frames.compute((box, frame_points), frame_orientations,
+                           reset=False)
+        trajectory = self.make_pmft()
+        trajectory.compute_trajectory(boxes, points, orientations)
+        npt.assert_equal(trajectory.bin_counts, frames.bin_counts)
+        npt.assert_allclose(trajectory.pmft, frames.pmft)
+        npt.assert_equal(trajectory.box, boxes[-1])
+
+        # Accumulate onto previous data.
+        trajectory.compute_trajectory(boxes, points, orientations,
+                                      reset=False)
+        npt.assert_equal(trajectory.bin_counts, 2*frames.bin_counts)
+
+        with self.assertRaises(ValueError):
+            trajectory.compute_trajectory(boxes[:-1], points, orientations)
+
+        # Orientations with the right size but the wrong shape are rejected
+        # without discarding the accumulated data.
+        with self.assertRaises(ValueError):
+            trajectory.compute_trajectory(
+                boxes, points, np.swapaxes(orientations, 0, 1))
+        npt.assert_equal(trajectory.bin_counts, 2*frames.bin_counts)
+
     def test_two_particles(self):
         (box, points), orientations = self.make_two_particle_system()
 
@@ -191,6 +261,31 @@ class TestPMFT2D(TestPMFT):
             pmft.compute((box, points), orientations,
                          neighbors={'mode': 'nearest', 'num_neighbors': 1})
 
+    def test_random_orientations(self):
+        """Test binning of bonds between randomly oriented particles."""
+        box, points = freud.data.make_random_system(self.L, 100, is2D=True,
+                                                    seed=1)
+        angles = np.random.RandomState(2).rand(len(points)) * TWO_PI
+        orientations = rowan.from_axis_angle([0, 0, 1], angles)
+        r_max = 0.9 * min(self.limits)
+        nlist = freud.locality.AABBQuery(box, points).query(
+            points, {'r_max': r_max, 'exclude_ii': True}).toNeighborList()
+
+        correct_bin_counts = np.zeros(self.bins, dtype=np.int32)
+        for i, j in nlist[:]:
+            r_ij = box.wrap(points[j] - points[i])
+            correct_bin_counts[self.get_bin(
+                points[i], points[i] + r_ij, orientations[i],
+                orientations[j])] += 1
+
+        pmft = self.make_pmft()
+        pmft.compute((box, points), angles, neighbors=nlist)
+        # Bonds exactly on a bin edge may be binned differently within
+        # floating point tolerance.
+        self.assertEqual(np.sum(pmft.bin_counts), len(nlist))
+        self.assertLessEqual(
+            np.sum(np.abs(pmft.bin_counts - correct_bin_counts)), 2)
+
 
 class TestPMFTR12(TestPMFT2D, unittest.TestCase):
     limits = (5.23, )
@@ -855,6 +950,44 @@ class TestPMFTXYZ(TestPMFT, unittest.TestCase):
             points_to_set(pmft.bin_counts),
             bins)
 
+    def test_random_equivalent_orientations(self):
+        """Compare against rotating every bond by every equivalent
+        orientation, with more orientations than are rotated at once."""
+        box, points = freud.data.make_random_system(10, 100, seed=0)
+        np.random.seed(0)
+        query_orientations = np.random.normal(size=(len(points), 4))
+        query_orientations /= np.linalg.norm(
+            query_orientations, axis=1)[:, np.newaxis]
+        equiv_orientations = np.random.normal(size=(40, 4))
+        equiv_orientations /= np.linalg.norm(
+            equiv_orientations, axis=1)[:, np.newaxis]
+
+        max_width = 3
+        nbins = 12
+        pmft = freud.pmft.PMFTXYZ(max_width, max_width, max_width, nbins)
+        query_args = dict(num_neighbors=6, exclude_ii=True)
+        pmft.compute((box, points), query_orientations,
+                     equiv_orientations=equiv_orientations,
+                     neighbors=query_args)
+
+        nlist = freud.locality.AABBQuery(box, points).query(
+            points, query_args).toNeighborList()
+        bonds = box.wrap(points[nlist.point_indices] -
+                         points[nlist.query_point_indices])
+        bonds = rowan.rotate(
+            rowan.conjugate(query_orientations[nlist.query_point_indices]),
+            bonds)
+        rotated = rowan.rotate(
+            equiv_orientations[:, np.newaxis], bonds[np.newaxis])
+        edges = np.linspace(-max_width, max_width, nbins + 1)
+        expected, _ = np.histogramdd(
+            rotated.reshape(-1, 3), bins=(edges, edges, edges))
+
+        # Allow a few bonds to fall into neighboring bins due to rounding.
+        self.assertEqual(pmft.bin_counts.sum(), expected.sum())
+        self.assertLessEqual(
+            np.abs(pmft.bin_counts - expected).sum(), 4)
+
 
 class TestPMFTR12ManagedArray(TestManagedArray, unittest.TestCase):
     def build_object(self):